@@ -10,12 +10,20 @@
 
 #include <cstdint>
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <complex>
+#include <cstring>
+#include <exception>
 #include <initializer_list>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <thread>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 //--------------------------------------------------------------------------------------------------
 //- Namespace alternatives for testing and also for detecting/avoiding ADL issues.  Pick a pair
@@ -32,18 +40,39 @@
 
 //#define LA_USE_VECTOR_ENGINE_ITERATORS
 
+//- Upper bound on the number of threads used by the multithreaded kernels.  If left undefined,
+//  the value of std::thread::hardware_concurrency() is used.
+//
+//#define LA_MAX_THREADS  1
+
+//- Enables the calls to CBLAS made by blas_matrix_operations.  The CMake option LA_USE_CBLAS
+//  defines this and links the BLAS library.
+//
+//#define LA_USE_CBLAS
+
 //- Implementation headers.
 //
 #include "linear_algebra/forward_declarations.hpp"
 #include "linear_algebra/private_support.hpp"
+#include "linear_algebra/reduced_precision.hpp"
 #include "linear_algebra/public_support.hpp"
 #include "linear_algebra/vector_iterators.hpp"
 #include "linear_algebra/dynamic_engines.hpp"
+#include "linear_algebra/cow_engine.hpp"
 #include "linear_algebra/fixed_size_engines.hpp"
 #include "linear_algebra/column_engine.hpp"
 #include "linear_algebra/row_engine.hpp"
 #include "linear_algebra/transpose_engine.hpp"
 #include "linear_algebra/submatrix_engine.hpp"
+#include "linear_algebra/triangular_engine.hpp"
+#include "linear_algebra/banded_engines.hpp"
+#include "linear_algebra/sparse_engines.hpp"
+#include "linear_algebra/symmetric_engines.hpp"
+#include "linear_algebra/diagonal_engines.hpp"
+#include "linear_algebra/low_rank_engine.hpp"
+#include "linear_algebra/toeplitz_engines.hpp"
+#include "linear_algebra/tiled_engine.hpp"
+#include "linear_algebra/span_engines.hpp"
 #include "linear_algebra/vector.hpp"
 #include "linear_algebra/matrix.hpp"
 #include "linear_algebra/library_aliases.hpp"
@@ -63,6 +92,9 @@
 #include "linear_algebra/multiplication_traits.hpp"
 #include "linear_algebra/multiplication_traits_impl.hpp"
 #include "linear_algebra/operation_traits.hpp"
+#include "linear_algebra/blas_operations.hpp"
 #include "linear_algebra/arithmetic_operators.hpp"
+#include "linear_algebra/linear_solvers.hpp"
+#include "linear_algebra/factorizations.hpp"
 
 #endif  //- LINEAR_ALGEBRA_HPP_DEFINED
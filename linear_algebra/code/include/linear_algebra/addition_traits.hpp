@@ -564,6 +564,89 @@ struct matrix_addition_engine_traits<OT,
 };
 
 
+//--------------------------------------------------------------------------------------------------
+//- ENGINE + ENGINE cases for tiled matrix/matrix.  The sum of two tiled matrices with the same
+//  tile size is tiled, with the tile order of the left-hand operand.
+//
+//- tiled_matrix_engine + tiled_matrix_engine.
+//
+template<class OT, class T1, size_t B, class A1, class LT1, class T2, class A2, class LT2>
+struct matrix_addition_engine_traits<OT,
+                                     tiled_matrix_engine<T1, B, A1, LT1>,
+                                     tiled_matrix_engine<T2, B, A2, LT2>>
+{
+    using element_type = matrix_addition_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = tiled_matrix_engine<element_type, B, alloc_type, LT1>;
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//- ENGINE + ENGINE cases for padded fixed-size engines.  The result is padded, with the alignment
+//  of the left-hand operand.
+//
+//- fs_padded_vector_engine + fs_padded_vector_engine.
+//
+template<class OT, class T1, size_t N1, size_t A1, class T2, size_t N2, size_t A2>
+struct matrix_addition_engine_traits<OT,
+                                     fs_padded_vector_engine<T1, N1, A1>,
+                                     fs_padded_vector_engine<T2, N2, A2>>
+{
+    static_assert(N1 == N2);
+    using element_type = matrix_addition_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_vector_engine<element_type, N1, A1>;
+};
+
+//- fs_padded_matrix_engine + fs_padded_matrix_engine.
+//
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class T2, size_t R2, size_t C2, size_t A2>
+struct matrix_addition_engine_traits<OT,
+                                     fs_padded_matrix_engine<T1, R1, C1, A1>,
+                                     fs_padded_matrix_engine<T2, R2, C2, A2>>
+{
+    static_assert(R1 == R2);
+    static_assert(C1 == C2);
+    using element_type = matrix_addition_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_matrix_engine<element_type, R1, C1, A1>;
+};
+
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class MCT1,
+         class T2, size_t R2, size_t C2, size_t A2>
+struct matrix_addition_engine_traits<OT,
+                                     transpose_engine<fs_padded_matrix_engine<T1, R1, C1, A1>, MCT1>,
+                                     fs_padded_matrix_engine<T2, R2, C2, A2>>
+{
+    static_assert(R1 == C2);
+    static_assert(C1 == R2);
+    using element_type = matrix_addition_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_matrix_engine<element_type, R2, C2, A1>;
+};
+
+template<class OT, class T1, size_t R1, size_t C1, size_t A1,
+         class T2, size_t R2, size_t C2, size_t A2, class MCT2>
+struct matrix_addition_engine_traits<OT,
+                                     fs_padded_matrix_engine<T1, R1, C1, A1>,
+                                     transpose_engine<fs_padded_matrix_engine<T2, R2, C2, A2>, MCT2>>
+{
+    static_assert(R1 == C2);
+    static_assert(C1 == R2);
+    using element_type = matrix_addition_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_matrix_engine<element_type, R1, C1, A1>;
+};
+
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class MCT1,
+         class T2, size_t R2, size_t C2, size_t A2, class MCT2>
+struct matrix_addition_engine_traits<OT,
+                                     transpose_engine<fs_padded_matrix_engine<T1, R1, C1, A1>, MCT1>,
+                                     transpose_engine<fs_padded_matrix_engine<T2, R2, C2, A2>, MCT2>>
+{
+    static_assert(R1 == R2);
+    static_assert(C1 == C2);
+    using element_type = matrix_addition_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_matrix_engine<element_type, C1, R1, A1>;
+};
+
+
 //==================================================================================================
 //                                 **** ADDITION TRAITS ****
 //==================================================================================================
@@ -588,7 +671,7 @@ struct matrix_addition_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>
     using size_type_2 = typename vector<ET2, OT2>::size_type;
     using size_type_r = typename result_type::size_type;
 
-    static result_type  add(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
+    static constexpr result_type  add(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
 };
 
 //------
@@ -604,7 +687,60 @@ struct matrix_addition_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
     using size_type_2 = typename matrix<ET2, OT2>::size_type;
     using size_type_r = typename result_type::size_type;
 
-    static result_type  add(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+    static constexpr result_type  add(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+//------
+//- tiled_matrix+tiled_matrix
+//
+template<class OT, class T1, size_t B, class A1, class LT1, class OT1, class T2, class A2, class LT2, class OT2>
+struct matrix_addition_traits<OT,
+                              matrix<tiled_matrix_engine<T1, B, A1, LT1>, OT1>,
+                              matrix<tiled_matrix_engine<T2, B, A2, LT2>, OT2>>
+{
+    using engine_type_1 = tiled_matrix_engine<T1, B, A1, LT1>;
+    using engine_type_2 = tiled_matrix_engine<T2, B, A2, LT2>;
+    using engine_type   = matrix_addition_engine_t<OT, engine_type_1, engine_type_2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    static result_type  add(matrix<engine_type_1, OT1> const& m1, matrix<engine_type_2, OT2> const& m2);
+};
+
+//-------------------------------------
+//- fs_padded_vector+fs_padded_vector
+//
+template<class OT, class T1, size_t N, size_t A1, class OT1, class T2, size_t A2, class OT2>
+struct matrix_addition_traits<OT,
+                              vector<fs_padded_vector_engine<T1, N, A1>, OT1>,
+                              vector<fs_padded_vector_engine<T2, N, A2>, OT2>>
+{
+    using engine_type_1 = fs_padded_vector_engine<T1, N, A1>;
+    using engine_type_2 = fs_padded_vector_engine<T2, N, A2>;
+    using engine_type   = matrix_addition_engine_t<OT, engine_type_1, engine_type_2>;
+    using op_traits     = OT;
+    using result_type   = vector<engine_type, op_traits>;
+
+    static constexpr result_type    add(vector<engine_type_1, OT1> const& v1,
+                                        vector<engine_type_2, OT2> const& v2);
+};
+
+//-------------------------------------
+//- fs_padded_matrix+fs_padded_matrix
+//
+template<class OT, class T1, size_t R, size_t C, size_t A1, class OT1, class T2, size_t A2, class OT2>
+struct matrix_addition_traits<OT,
+                              matrix<fs_padded_matrix_engine<T1, R, C, A1>, OT1>,
+                              matrix<fs_padded_matrix_engine<T2, R, C, A2>, OT2>>
+{
+    using engine_type_1 = fs_padded_matrix_engine<T1, R, C, A1>;
+    using engine_type_2 = fs_padded_matrix_engine<T2, R, C, A2>;
+    using engine_type   = matrix_addition_engine_t<OT, engine_type_1, engine_type_2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    static constexpr result_type    add(matrix<engine_type_1, OT1> const& m1,
+                                        matrix<engine_type_2, OT2> const& m2);
 };
 
 }       //- STD_LA namespace
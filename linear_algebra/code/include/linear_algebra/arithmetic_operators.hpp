@@ -14,7 +14,7 @@ namespace STD_LA {
 //=================================================================================================
 //
 template<class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 operator +(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2)
 {
     using op_traits  = matrix_operation_traits_selector_t<OT1, OT2>;
@@ -26,7 +26,7 @@ operator +(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2)
 }
 
 template<class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 operator +(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2)
 {
     using op_traits  = matrix_operation_traits_selector_t<OT1, OT2>;
@@ -43,7 +43,7 @@ operator +(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2)
 //=================================================================================================
 //
 template<class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 operator -(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2)
 {
     using op_traits  = matrix_operation_traits_selector_t<OT1, OT2>;
@@ -55,7 +55,7 @@ operator -(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2)
 }
 
 template<class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 operator -(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2)
 {
     using op_traits  = matrix_operation_traits_selector_t<OT1, OT2>;
@@ -72,7 +72,7 @@ operator -(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2)
 //=================================================================================================
 //
 template<class ET1, class OT1>
-inline auto
+constexpr auto
 operator -(vector<ET1, OT1> const& v1)
 {
     using op1_type   = vector<ET1, OT1>;
@@ -83,7 +83,7 @@ operator -(vector<ET1, OT1> const& v1)
 }
 
 template<class ET1, class OT1>
-inline auto
+constexpr auto
 operator -(matrix<ET1, OT1> const& m1)
 {
     using op1_type   = matrix<ET1, OT1>;
@@ -100,7 +100,7 @@ operator -(matrix<ET1, OT1> const& m1)
 //- vector*scalar
 //
 template<class ET1, class OT1, class S2>
-inline auto
+constexpr auto
 operator *(vector<ET1, OT1> const& v1, S2 const& s2)
 {
     using op_traits  = OT1;
@@ -112,7 +112,7 @@ operator *(vector<ET1, OT1> const& v1, S2 const& s2)
 }
 
 template<class S1, class ET2, class OT2>
-inline auto
+constexpr auto
 operator *(S1 const& s1, vector<ET2, OT2> const& v2)
 {
     using op_traits  = OT2;
@@ -127,7 +127,7 @@ operator *(S1 const& s1, vector<ET2, OT2> const& v2)
 //- matrix*scalar
 //
 template<class ET1, class OT1, class S2>
-inline auto
+constexpr auto
 operator *(matrix<ET1, OT1> const& m1, S2 const& s2)
 {
     using op_traits  = OT1;
@@ -139,7 +139,7 @@ operator *(matrix<ET1, OT1> const& m1, S2 const& s2)
 }
 
 template<class S1, class ET2, class OT2>
-inline auto
+constexpr auto
 operator *(S1 const& s1, matrix<ET2, OT2> const& m2)
 {
     using op_traits  = OT2;
@@ -154,7 +154,7 @@ operator *(S1 const& s1, matrix<ET2, OT2> const& m2)
 //- vector*vector
 //
 template<class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 operator *(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2)
 {
     using op_traits  = matrix_operation_traits_selector_t<OT1, OT2>;
@@ -169,7 +169,7 @@ operator *(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2)
 //- matrix*vector
 //
 template<class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 operator *(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2)
 {
     using op_traits  = matrix_operation_traits_selector_t<OT1, OT2>;
@@ -184,7 +184,7 @@ operator *(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2)
 //- vector*matrix
 //
 template<class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 operator *(vector<ET1, OT1> const& v1, matrix<ET2, OT2> const& m2)
 {
     using op_traits  = matrix_operation_traits_selector_t<OT1, OT2>;
@@ -199,7 +199,7 @@ operator *(vector<ET1, OT1> const& v1, matrix<ET2, OT2> const& m2)
 //- matrix*matrix
 //
 template<class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 operator *(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2)
 {
     using op_traits  = matrix_operation_traits_selector_t<OT1, OT2>;
@@ -210,5 +210,61 @@ operator *(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2)
     return mul_traits::multiply(m1, m2);
 }
 
+
+//=================================================================================================
+//  Symmetric rank-k product (the "Gram" matrix), which computes transpose(m1)*m1.  The result is
+//  symmetric by construction, so it is returned in a symmetric packed engine and only its lower
+//  triangle is computed, which halves both the storage and the multiply-adds of m1.t()*m1.
+//=================================================================================================
+//
+template<class ET1, class OT1>
+inline auto
+gram(matrix<ET1, OT1> const& m1)
+{
+    using element_type_1 = typename ET1::element_type;
+    using element_type   = matrix_multiplication_element_t<OT1, element_type_1, element_type_1>;
+    using engine_type    = symmetric_packed_engine<element_type, allocator<element_type>>;
+    using result_type    = matrix<engine_type, OT1>;
+    using size_type_1    = typename matrix<ET1, OT1>::size_type;
+
+    size_t const    rows = static_cast<size_t>(m1.rows());
+    size_t const    n    = static_cast<size_t>(m1.columns());
+    engine_type     er(n);
+
+    PrintOperandTypes<result_type>("gram", m1);
+
+    detail::parallel_for_triangle(n, rows * n * (n + 1) / 2, [&](size_t first, size_t last)
+    {
+        using acc_type = detail::accumulator_t<element_type>;
+
+        std::vector<acc_type>   acc;
+
+        for (size_t i = first;  i < last;  ++i)
+        {
+            element_type* const     p_row = er.packed_data() + i*(i + 1)/2;
+
+            acc.assign(i + 1, acc_type{});
+            for (size_t k = 0;  k < rows;  ++k)
+            {
+                size_type_1 const   k1 = static_cast<size_type_1>(k);
+                auto const          a1 = m1(k1, static_cast<size_type_1>(i));
+
+                if (a1 == element_type_1()) continue;
+
+                for (size_t j = 0;  j <= i;  ++j)
+                {
+                    acc[j] += a1 * m1(k1, static_cast<size_type_1>(j));
+                }
+            }
+            for (size_t j = 0;  j <= i;  ++j)
+            {
+                p_row[j] = static_cast<element_type>(acc[j]);
+            }
+        }
+    });
+
+    return result_type(std::move(er));
+}
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_ARITHMETIC_OPERATORS_HPP_DEFINED
@@ -0,0 +1,339 @@
+//==================================================================================================
+//  File:       banded_engines.hpp
+//
+//  Summary:    This header defines an owning matrix engine for banded matrices.  A banded matrix
+//              has all of its (possibly) non-zero elements within a band about the main
+//              diagonal, described by a lower and an upper bandwidth; only the elements of the
+//              band are stored, and all other elements are implicitly zero.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_BANDED_ENGINES_HPP_DEFINED
+#define LINEAR_ALGEBRA_BANDED_ENGINES_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//  Banded matrix engine with runtime lower bandwidth (kl) and upper bandwidth (ku).  Element
+//  (i, j) lies within the band when i - kl <= j <= i + ku.  The band is stored by rows, with
+//  kl + ku + 1 slots per row; slot (j - i + kl) of row i holds element (i, j).  Slots that fall
+//  outside the matrix (at the corners of the band) are kept at zero.
+//
+//  Elements outside the band cannot be written, so the engine is readable; elements within the
+//  band are written through the band_element() member function.
+//==================================================================================================
+//
+template<class T, class AT>
+class banded_matrix_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using element_array   = std::vector<element_type, allocator_type>;
+
+    //- Construct/copy/destroy
+    //
+    ~banded_matrix_engine() noexcept = default;
+
+    banded_matrix_engine();
+    banded_matrix_engine(banded_matrix_engine&& rhs) noexcept;
+    banded_matrix_engine(banded_matrix_engine const& rhs) = default;
+    banded_matrix_engine(size_type rows, size_type cols, size_type kl, size_type ku);
+    template<class ET2>
+    explicit banded_matrix_engine(ET2 const& rhs);
+
+    banded_matrix_engine&   operator =(banded_matrix_engine&& rhs) noexcept;
+    banded_matrix_engine&   operator =(banded_matrix_engine const& rhs) = default;
+    template<class ET2>
+    banded_matrix_engine&   operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    size_type   lower_bandwidth() const noexcept;
+    size_type   upper_bandwidth() const noexcept;
+    size_type   band_width() const noexcept;
+
+    //- Element access
+    //
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    bool                in_band(size_type i, size_type j) const noexcept;
+    element_type&       band_element(size_type i, size_type j);
+    element_type const& band_element(size_type i, size_type j) const;
+
+    //- Band storage access
+    //
+    const_pointer       band_data() const noexcept;
+    pointer             band_data() noexcept;
+
+    //- Modifiers
+    //
+    void    swap(banded_matrix_engine& rhs) noexcept;
+
+  private:
+    size_type       m_rows;
+    size_type       m_cols;
+    size_type       m_kl;
+    size_type       m_ku;
+    element_array   m_elems;        //- Holds m_rows * (m_kl + m_ku + 1) band slots
+
+    template<class ET2>
+    void    assign(ET2 const& rhs);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class AT>
+banded_matrix_engine<T,AT>::banded_matrix_engine()
+:   m_rows(0)
+,   m_cols(0)
+,   m_kl(0)
+,   m_ku(0)
+,   m_elems()
+{}
+
+template<class T, class AT>
+banded_matrix_engine<T,AT>::banded_matrix_engine(banded_matrix_engine&& rhs) noexcept
+:   banded_matrix_engine()
+{
+    rhs.swap(*this);
+}
+
+template<class T, class AT>
+banded_matrix_engine<T,AT>::banded_matrix_engine
+(size_type rows, size_type cols, size_type kl, size_type ku)
+:   m_rows(rows)
+,   m_cols(cols)
+,   m_kl(kl)
+,   m_ku(ku)
+,   m_elems(rows * (kl + ku + 1), value_type())
+{}
+
+template<class T, class AT>
+template<class ET2>
+banded_matrix_engine<T,AT>::banded_matrix_engine(ET2 const& rhs)
+:   banded_matrix_engine()
+{
+    assign(rhs);
+}
+
+template<class T, class AT>
+banded_matrix_engine<T,AT>&
+banded_matrix_engine<T,AT>::operator =(banded_matrix_engine&& rhs) noexcept
+{
+    banded_matrix_engine    tmp;
+    tmp.swap(rhs);
+    tmp.swap(*this);
+    return *this;
+}
+
+template<class T, class AT>
+template<class ET2>
+banded_matrix_engine<T,AT>&
+banded_matrix_engine<T,AT>::operator =(ET2 const& rhs)
+{
+    assign(rhs);
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::size_type
+banded_matrix_engine<T,AT>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::size_type
+banded_matrix_engine<T,AT>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::size_tuple
+banded_matrix_engine<T,AT>::size() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::size_type
+banded_matrix_engine<T,AT>::column_capacity() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::size_type
+banded_matrix_engine<T,AT>::row_capacity() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::size_tuple
+banded_matrix_engine<T,AT>::capacity() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::size_type
+banded_matrix_engine<T,AT>::lower_bandwidth() const noexcept
+{
+    return m_kl;
+}
+
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::size_type
+banded_matrix_engine<T,AT>::upper_bandwidth() const noexcept
+{
+    return m_ku;
+}
+
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::size_type
+banded_matrix_engine<T,AT>::band_width() const noexcept
+{
+    return m_kl + m_ku + 1;
+}
+
+//----------------
+//- Element access
+//
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::const_reference
+banded_matrix_engine<T,AT>::operator ()(size_type i, size_type j) const
+{
+    return in_band(i, j) ? m_elems[i*(m_kl + m_ku + 1) + (j + m_kl - i)] : value_type();
+}
+
+template<class T, class AT> inline
+bool
+banded_matrix_engine<T,AT>::in_band(size_type i, size_type j) const noexcept
+{
+    return j + m_kl >= i  &&  j <= i + m_ku;
+}
+
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::element_type&
+banded_matrix_engine<T,AT>::band_element(size_type i, size_type j)
+{
+    return m_elems[i*(m_kl + m_ku + 1) + (j + m_kl - i)];
+}
+
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::element_type const&
+banded_matrix_engine<T,AT>::band_element(size_type i, size_type j) const
+{
+    return m_elems[i*(m_kl + m_ku + 1) + (j + m_kl - i)];
+}
+
+//----------------------
+//- Band storage access
+//
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::const_pointer
+banded_matrix_engine<T,AT>::band_data() const noexcept
+{
+    return m_elems.data();
+}
+
+template<class T, class AT> inline
+typename banded_matrix_engine<T,AT>::pointer
+banded_matrix_engine<T,AT>::band_data() noexcept
+{
+    return m_elems.data();
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class AT>
+void
+banded_matrix_engine<T,AT>::swap(banded_matrix_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        detail::la_swap(m_rows, rhs.m_rows);
+        detail::la_swap(m_cols, rhs.m_cols);
+        detail::la_swap(m_kl, rhs.m_kl);
+        detail::la_swap(m_ku, rhs.m_ku);
+        m_elems.swap(rhs.m_elems);
+    }
+}
+
+//------------------------
+//- Private implementation
+//
+//  The bandwidths of the result are the smallest ones that hold all of the source's non-zero
+//  elements.
+//
+template<class T, class AT>
+template<class ET2>
+void
+banded_matrix_engine<T,AT>::assign(ET2 const& rhs)
+{
+    static_assert(is_matrix_engine_v<ET2>);
+    using src_size_type = typename ET2::size_type;
+
+    size_type const     rows = static_cast<size_type>(rhs.rows());
+    size_type const     cols = static_cast<size_type>(rhs.columns());
+    size_type           kl   = 0;
+    size_type           ku   = 0;
+    src_size_type       si, sj;
+    size_type           di, dj;
+
+    for (di = 0, si = 0;  di < rows;  ++di, ++si)
+    {
+        for (dj = 0, sj = 0;  dj < cols;  ++dj, ++sj)
+        {
+            if (static_cast<value_type>(rhs(si, sj)) != value_type())
+            {
+                kl = max(kl, (di > dj) ? di - dj : size_type(0));
+                ku = max(ku, (dj > di) ? dj - di : size_type(0));
+            }
+        }
+    }
+
+    banded_matrix_engine    tmp(rows, cols, kl, ku);
+
+    for (di = 0, si = 0;  di < rows;  ++di, ++si)
+    {
+        size_type const     first = (di > kl) ? di - kl : 0;
+        size_type const     last  = min(cols, di + ku + 1);
+
+        for (dj = first, sj = static_cast<src_size_type>(first);  dj < last;  ++dj, ++sj)
+        {
+            tmp.band_element(di, dj) = static_cast<value_type>(rhs(si, sj));
+        }
+    }
+
+    tmp.swap(*this);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_BANDED_ENGINES_HPP_DEFINED
@@ -0,0 +1,461 @@
+//==================================================================================================
+//  File:       blas_operations.hpp
+//
+//  Summary:    This header defines an opt-in operation traits type, blas_matrix_operations, that
+//              computes products and sums of dense operands whose elements are float, double,
+//              complex<float>, or complex<double> by calling an installed CBLAS library.
+//
+//              The calls to CBLAS are compiled only when LA_USE_CBLAS is defined (the CMake
+//              option of the same name does this, and links the BLAS library).  Otherwise, and
+//              whenever the operands' types or layouts cannot be described to BLAS, the traits
+//              forward to the library's own arithmetic traits.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_BLAS_OPERATIONS_HPP_DEFINED
+#define LINEAR_ALGEBRA_BLAS_OPERATIONS_HPP_DEFINED
+
+#ifdef LA_USE_CBLAS
+    #include <cblas.h>
+#endif
+
+namespace STD_LA {
+#ifdef LA_USE_CBLAS
+namespace detail {
+//==================================================================================================
+//  Some private helpers for describing operands to CBLAS and for calling the CBLAS routines
+//  appropriate to each element type.  All calls use row-major ordering.
+//==================================================================================================
+//
+template<class T> inline constexpr
+bool    is_blas_element_v = is_same_v<T, float>  ||  is_same_v<T, double>  ||
+                            is_same_v<T, complex<float>>  ||  is_same_v<T, complex<double>>;
+
+//- Determines whether the engines of two operands and of their result all expose a strided
+//  layout and hold the same BLAS element type, so that CBLAS may be called to combine them.
+//
+template<class ET1, class ET2, class ETR> inline constexpr
+bool    is_blas_compatible_v = has_strided_layout_v<ET1>  &&  has_strided_layout_v<ET2>  &&
+                               is_dense_owning_engine_v<ETR>  &&
+                               is_same_v<typename ET1::value_type, typename ETR::value_type>  &&
+                               is_same_v<typename ET2::value_type, typename ETR::value_type>  &&
+                               is_blas_element_v<typename ETR::value_type>;
+
+//- Returns true if a value can be passed to CBLAS as an int.
+//
+inline bool
+fits_blas_int(size_t n) noexcept
+{
+    return n <= (size_t) numeric_limits<int>::max();
+}
+
+//- Describes a rows x cols operand with the given strides as a row-major matrix that is used
+//  either as is, or transposed.  Returns false if the operand's elements are not laid out in a
+//  way that BLAS can describe, i.e., when neither of its strides is one.
+//
+inline bool
+blas_matrix_layout(size_t rows, size_t cols, ptrdiff_t rs, ptrdiff_t cs,
+                   CBLAS_TRANSPOSE& trans, int& ld) noexcept
+{
+    ptrdiff_t const     min_rs = (ptrdiff_t) max<size_t>(cols, 1);
+    ptrdiff_t const     min_cs = (ptrdiff_t) max<size_t>(rows, 1);
+
+    if (cols <= 1) cs = 1;
+    if (rows <= 1) rs = min_rs;
+
+    if (cs == 1  &&  rs >= min_rs  &&  fits_blas_int((size_t) rs))
+    {
+        trans = CblasNoTrans;
+        ld    = (int) rs;
+        return true;
+    }
+    else if (rs == 1  &&  cs >= min_cs  &&  fits_blas_int((size_t) cs))
+    {
+        trans = CblasTrans;
+        ld    = (int) cs;
+        return true;
+    }
+    return false;
+}
+
+//- Computes C = op(A) * op(B), where op(A) is m x k and op(B) is k x n.
+//
+inline void
+blas_gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,
+          float const* p_a, int lda, float const* p_b, int ldb, float* p_c, int ldc)
+{
+    cblas_sgemm(CblasRowMajor, ta, tb, m, n, k, 1.0f, p_a, lda, p_b, ldb, 0.0f, p_c, ldc);
+}
+
+inline void
+blas_gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,
+          double const* p_a, int lda, double const* p_b, int ldb, double* p_c, int ldc)
+{
+    cblas_dgemm(CblasRowMajor, ta, tb, m, n, k, 1.0, p_a, lda, p_b, ldb, 0.0, p_c, ldc);
+}
+
+inline void
+blas_gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,
+          complex<float> const* p_a, int lda, complex<float> const* p_b, int ldb,
+          complex<float>* p_c, int ldc)
+{
+    complex<float> const    one(1), zero(0);
+    cblas_cgemm(CblasRowMajor, ta, tb, m, n, k, &one, p_a, lda, p_b, ldb, &zero, p_c, ldc);
+}
+
+inline void
+blas_gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,
+          complex<double> const* p_a, int lda, complex<double> const* p_b, int ldb,
+          complex<double>* p_c, int ldc)
+{
+    complex<double> const   one(1), zero(0);
+    cblas_zgemm(CblasRowMajor, ta, tb, m, n, k, &one, p_a, lda, p_b, ldb, &zero, p_c, ldc);
+}
+
+//- Computes y = op(A) * x, where A is stored as an m x n row-major matrix.
+//
+inline void
+blas_gemv(CBLAS_TRANSPOSE ta, int m, int n, float const* p_a, int lda,
+          float const* p_x, int incx, float* p_y)
+{
+    cblas_sgemv(CblasRowMajor, ta, m, n, 1.0f, p_a, lda, p_x, incx, 0.0f, p_y, 1);
+}
+
+inline void
+blas_gemv(CBLAS_TRANSPOSE ta, int m, int n, double const* p_a, int lda,
+          double const* p_x, int incx, double* p_y)
+{
+    cblas_dgemv(CblasRowMajor, ta, m, n, 1.0, p_a, lda, p_x, incx, 0.0, p_y, 1);
+}
+
+inline void
+blas_gemv(CBLAS_TRANSPOSE ta, int m, int n, complex<float> const* p_a, int lda,
+          complex<float> const* p_x, int incx, complex<float>* p_y)
+{
+    complex<float> const    one(1), zero(0);
+    cblas_cgemv(CblasRowMajor, ta, m, n, &one, p_a, lda, p_x, incx, &zero, p_y, 1);
+}
+
+inline void
+blas_gemv(CBLAS_TRANSPOSE ta, int m, int n, complex<double> const* p_a, int lda,
+          complex<double> const* p_x, int incx, complex<double>* p_y)
+{
+    complex<double> const   one(1), zero(0);
+    cblas_zgemv(CblasRowMajor, ta, m, n, &one, p_a, lda, p_x, incx, &zero, p_y, 1);
+}
+
+//- Computes y = x + y over n elements.
+//
+inline void
+blas_axpy(int n, float const* p_x, int incx, float* p_y, int incy)
+{
+    cblas_saxpy(n, 1.0f, p_x, incx, p_y, incy);
+}
+
+inline void
+blas_axpy(int n, double const* p_x, int incx, double* p_y, int incy)
+{
+    cblas_daxpy(n, 1.0, p_x, incx, p_y, incy);
+}
+
+inline void
+blas_axpy(int n, complex<float> const* p_x, int incx, complex<float>* p_y, int incy)
+{
+    complex<float> const    one(1);
+    cblas_caxpy(n, &one, p_x, incx, p_y, incy);
+}
+
+inline void
+blas_axpy(int n, complex<double> const* p_x, int incx, complex<double>* p_y, int incy)
+{
+    complex<double> const   one(1);
+    cblas_zaxpy(n, &one, p_x, incx, p_y, incy);
+}
+
+}       //- detail namespace
+#endif  //- LA_USE_CBLAS
+
+//==================================================================================================
+//                              **** BLAS ARITHMETIC TRAITS ****
+//==================================================================================================
+//  Multiplication traits used by blas_matrix_operations.  Products that cannot be computed by
+//  CBLAS are computed by the corresponding specialization of matrix_multiplication_traits.
+//==================================================================================================
+//
+template<class OTR, class OP1, class OP2>
+struct blas_multiplication_traits
+:   public matrix_multiplication_traits<OTR, OP1, OP2>
+{};
+
+//---------------
+//- matrix*vector
+//
+template<class OTR, class ET1, class OT1, class ET2, class OT2>
+struct blas_multiplication_traits<OTR, matrix<ET1, OT1>, vector<ET2, OT2>>
+:   public matrix_multiplication_traits<OTR, matrix<ET1, OT1>, vector<ET2, OT2>>
+{
+    using base_traits = matrix_multiplication_traits<OTR, matrix<ET1, OT1>, vector<ET2, OT2>>;
+    using result_type = typename base_traits::result_type;
+
+    static result_type  multiply(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+//---------------
+//- matrix*matrix
+//
+template<class OTR, class ET1, class OT1, class ET2, class OT2>
+struct blas_multiplication_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>
+:   public matrix_multiplication_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using base_traits = matrix_multiplication_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>;
+    using result_type = typename base_traits::result_type;
+
+    static result_type  multiply(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+//==================================================================================================
+//  Addition traits used by blas_matrix_operations.  A sum is computed by copying the left-hand
+//  operand into the result and then adding the right-hand operand to it with AXPY.
+//==================================================================================================
+//
+template<class OTR, class OP1, class OP2>
+struct blas_addition_traits
+:   public matrix_addition_traits<OTR, OP1, OP2>
+{};
+
+//---------------
+//- vector+vector
+//
+template<class OTR, class ET1, class OT1, class ET2, class OT2>
+struct blas_addition_traits<OTR, vector<ET1, OT1>, vector<ET2, OT2>>
+:   public matrix_addition_traits<OTR, vector<ET1, OT1>, vector<ET2, OT2>>
+{
+    using base_traits = matrix_addition_traits<OTR, vector<ET1, OT1>, vector<ET2, OT2>>;
+    using result_type = typename base_traits::result_type;
+
+    static result_type  add(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
+};
+
+//---------------
+//- matrix+matrix
+//
+template<class OTR, class ET1, class OT1, class ET2, class OT2>
+struct blas_addition_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>
+:   public matrix_addition_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>
+{
+    using base_traits = matrix_addition_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>;
+    using result_type = typename base_traits::result_type;
+
+    static result_type  add(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+//==================================================================================================
+//                               **** BLAS OPERATION TRAITS ****
+//==================================================================================================
+//  Operation traits type that behaves like matrix_operation_traits, except that products and
+//  sums of dense operands are computed by CBLAS when LA_USE_CBLAS is defined.  It is selected
+//  by using it as the operation traits of a vector or matrix, e.g.:
+//
+//      using blas_matrix = matrix<dr_matrix_engine<double, allocator<double>>,
+//                                 blas_matrix_operations>;
+//==================================================================================================
+//
+struct blas_matrix_operations : public matrix_operation_traits
+{
+    template<class OTR, class OP1, class OP2>
+    using addition_traits = blas_addition_traits<OTR, OP1, OP2>;
+
+    template<class OTR, class OP1, class OP2>
+    using multiplication_traits = blas_multiplication_traits<OTR, OP1, OP2>;
+};
+
+//==================================================================================================
+//                         **** BLAS TRAITS FUNCTION IMPLEMENTATION ****
+//==================================================================================================
+//
+//- matrix*vector
+//
+template<class OTR, class ET1, class OT1, class ET2, class OT2>
+inline auto
+blas_multiplication_traits<OTR, matrix<ET1, OT1>, vector<ET2, OT2>>::multiply
+(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+#ifdef LA_USE_CBLAS
+    if constexpr (detail::is_blas_compatible_v<ET1, ET2, typename result_type::engine_type>)
+    {
+        size_t const        rows  = (size_t) m1.rows();
+        size_t const        inner = (size_t) m1.columns();
+        auto const          [a_rs, a_cs] = m1.engine().stride();
+        ptrdiff_t const     x_s = v2.engine().stride();
+        CBLAS_TRANSPOSE     ta;
+        int                 lda;
+
+        if ((size_t) v2.elements() != inner)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        if (rows != 0  &&  inner != 0  &&  detail::fits_blas_int(rows)  &&  detail::fits_blas_int(inner)  &&
+            x_s > 0  &&  detail::fits_blas_int((size_t) x_s)  &&
+            detail::blas_matrix_layout(rows, inner, a_rs, a_cs, ta, lda))
+        {
+            PrintOperandTypes<result_type>("blas_multiplication_traits (m*v)", m1, v2);
+
+            result_type     vr;
+
+            if constexpr (result_requires_resize(vr))
+            {
+                vr.resize(rows);
+            }
+
+            //- A transposed operand is stored as an inner x rows row-major matrix.
+            //
+            int const   m = (ta == CblasNoTrans) ? (int) rows : (int) inner;
+            int const   n = (ta == CblasNoTrans) ? (int) inner : (int) rows;
+
+            detail::blas_gemv(ta, m, n, m1.engine().data(), lda,
+                              v2.engine().data(), (int) x_s, vr.engine().data());
+            return vr;
+        }
+    }
+#endif
+    return base_traits::multiply(m1, v2);
+}
+
+//- matrix*matrix
+//
+template<class OTR, class ET1, class OT1, class ET2, class OT2>
+inline auto
+blas_multiplication_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+#ifdef LA_USE_CBLAS
+    if constexpr (detail::is_blas_compatible_v<ET1, ET2, typename result_type::engine_type>)
+    {
+        size_t const        rows  = (size_t) m1.rows();
+        size_t const        cols  = (size_t) m2.columns();
+        size_t const        inner = (size_t) m1.columns();
+        auto const          [a_rs, a_cs] = m1.engine().stride();
+        auto const          [b_rs, b_cs] = m2.engine().stride();
+        CBLAS_TRANSPOSE     ta, tb;
+        int                 lda, ldb;
+
+        if ((size_t) m2.rows() != inner)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        if (rows != 0  &&  cols != 0  &&  inner != 0  &&
+            detail::fits_blas_int(rows)  &&  detail::fits_blas_int(cols)  &&
+            detail::fits_blas_int(inner)  &&
+            detail::blas_matrix_layout(rows, inner, a_rs, a_cs, ta, lda)  &&
+            detail::blas_matrix_layout(inner, cols, b_rs, b_cs, tb, ldb))
+        {
+            PrintOperandTypes<result_type>("blas_multiplication_traits (m*m)", m1, m2);
+
+            result_type     mr;
+
+            if constexpr (result_requires_resize(mr))
+            {
+                mr.resize(rows, cols);
+            }
+
+            int const   ldc = (int) get<0>(mr.engine().stride());
+
+            detail::blas_gemm(ta, tb, (int) rows, (int) cols, (int) inner,
+                              m1.engine().data(), lda, m2.engine().data(), ldb,
+                              mr.engine().data(), ldc);
+            return mr;
+        }
+    }
+#endif
+    return base_traits::multiply(m1, m2);
+}
+
+//- vector+vector
+//
+template<class OTR, class ET1, class OT1, class ET2, class OT2>
+inline auto
+blas_addition_traits<OTR, vector<ET1, OT1>, vector<ET2, OT2>>::add
+(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2) -> result_type
+{
+#ifdef LA_USE_CBLAS
+    if constexpr (detail::is_blas_compatible_v<ET1, ET2, typename result_type::engine_type>)
+    {
+        size_t const        elems = (size_t) v1.elements();
+        ptrdiff_t const     x_s   = v2.engine().stride();
+
+        if ((size_t) v2.elements() != elems)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        if (elems != 0  &&  detail::fits_blas_int(elems)  &&
+            x_s > 0  &&  detail::fits_blas_int((size_t) x_s))
+        {
+            PrintOperandTypes<result_type>("blas_addition_traits", v1, v2);
+
+            result_type     vr;
+
+            vr = v1;
+            detail::blas_axpy((int) elems, v2.engine().data(), (int) x_s, vr.engine().data(), 1);
+            return vr;
+        }
+    }
+#endif
+    return base_traits::add(v1, v2);
+}
+
+//- matrix+matrix.  Rows are added one at a time unless both the result and the right-hand
+//  operand are contiguous, in which case they are added all at once.
+//
+template<class OTR, class ET1, class OT1, class ET2, class OT2>
+inline auto
+blas_addition_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>::add
+(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+#ifdef LA_USE_CBLAS
+    if constexpr (detail::is_blas_compatible_v<ET1, ET2, typename result_type::engine_type>)
+    {
+        size_t const    rows = (size_t) m1.rows();
+        size_t const    cols = (size_t) m1.columns();
+        auto const      [b_rs, b_cs] = m2.engine().stride();
+
+        if ((size_t) m2.rows() != rows  ||  (size_t) m2.columns() != cols)
+        {
+            throw runtime_error("invalid size");
+        }
+
+        if (rows != 0  &&  cols != 0  &&  detail::fits_blas_int(rows * cols)  &&
+            b_cs > 0  &&  detail::fits_blas_int((size_t) b_cs))
+        {
+            PrintOperandTypes<result_type>("blas_addition_traits", m1, m2);
+
+            result_type     mr;
+
+            mr = m1;
+
+            auto const      p_b = m2.engine().data();
+            auto const      p_c = mr.engine().data();
+            ptrdiff_t const c_rs = get<0>(mr.engine().stride());
+
+            if (mr.engine().is_contiguous()  &&  m2.engine().is_contiguous())
+            {
+                detail::blas_axpy((int) (rows * cols), p_b, 1, p_c, 1);
+            }
+            else
+            {
+                for (size_t i = 0;  i < rows;  ++i)
+                {
+                    detail::blas_axpy((int) cols, p_b + (ptrdiff_t) i * b_rs, (int) b_cs,
+                                      p_c + (ptrdiff_t) i * c_rs, 1);
+                }
+            }
+            return mr;
+        }
+    }
+#endif
+    return base_traits::add(m1, m2);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_BLAS_OPERATIONS_HPP_DEFINED
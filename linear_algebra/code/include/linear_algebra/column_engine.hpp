@@ -66,6 +66,15 @@ class column_engine
     //
     constexpr reference     operator ()(size_type i) const;
 
+    //- Layout
+    //
+    template<class ET2 = ET, detail::enable_if_strided<ET, ET2> = true>
+    constexpr pointer           data() const noexcept;
+    template<class ET2 = ET, detail::enable_if_strided<ET, ET2> = true>
+    constexpr difference_type   stride() const noexcept;
+    template<class ET2 = ET, detail::enable_if_strided<ET, ET2> = true>
+    constexpr bool              is_contiguous() const noexcept;
+
     //- Modifiers
     //
     constexpr void      swap(column_engine& rhs);
@@ -149,6 +158,33 @@ column_engine<ET,VCT>::operator ()(size_type i) const
     return (*mp_other)(i, m_column);
 }
 
+//--------
+//- Layout
+//
+template<class ET, class VCT>
+template<class ET2, detail::enable_if_strided<ET, ET2>> constexpr 
+typename column_engine<ET,VCT>::pointer
+column_engine<ET,VCT>::data() const noexcept
+{
+    return mp_other->data() + static_cast<difference_type>(m_column) * get<1>(mp_other->stride());
+}
+
+template<class ET, class VCT>
+template<class ET2, detail::enable_if_strided<ET, ET2>> constexpr 
+typename column_engine<ET,VCT>::difference_type
+column_engine<ET,VCT>::stride() const noexcept
+{
+    return get<0>(mp_other->stride());
+}
+
+template<class ET, class VCT>
+template<class ET2, detail::enable_if_strided<ET, ET2>> constexpr 
+bool
+column_engine<ET,VCT>::is_contiguous() const noexcept
+{
+    return get<0>(mp_other->stride()) == 1  ||  mp_other->rows() <= 1;
+}
+
 //-----------
 //- Modifiers
 //
@@ -0,0 +1,386 @@
+//==================================================================================================
+//  File:       cow_engine.hpp
+//
+//  Summary:    This header defines a dynamically-resizable matrix engine whose copies share a
+//              reference-counted buffer, which is copied only when a sharing engine is first
+//              modified.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_COW_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_COW_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//  Copy-on-write matrix engine.  The elements are held by a dr_matrix_engine that is shared by
+//  all copies of an engine, so that copying, passing, and returning by value cost a reference
+//  count update rather than an allocation and element copy.  Any member function that can
+//  modify the elements first gives the engine a private copy of them if they are shared.
+//
+//  Const member functions never copy, so a copy handed to another thread can be read there
+//  while the original continues to be modified.  As with other copy-on-write containers, a
+//  reference or pointer obtained from a non-const engine must not be used to modify elements
+//  after the engine has been copied, since the copy would then observe the modification.
+//==================================================================================================
+//
+template<class T, class AT>
+class cow_matrix_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category    = resizable_matrix_engine_tag;
+    using element_type       = T;
+    using value_type         = remove_cv_t<T>;
+    using allocator_type     = AT;
+    using pointer            = typename allocator_traits<AT>::pointer;
+    using const_pointer      = typename allocator_traits<AT>::const_pointer;
+    using reference          = element_type&;
+    using const_reference    = element_type const&;
+    using difference_type    = ptrdiff_t;
+    using size_type          = size_t;
+    using size_tuple         = tuple<size_type, size_type>;
+    using stride_tuple       = tuple<difference_type, difference_type>;
+    using shared_engine_type = dr_matrix_engine<T, AT>;
+
+    //- Construct/copy/destroy
+    //
+    ~cow_matrix_engine() noexcept = default;
+
+    cow_matrix_engine() noexcept = default;
+    cow_matrix_engine(cow_matrix_engine&& rhs) noexcept = default;
+    cow_matrix_engine(cow_matrix_engine const& rhs) noexcept = default;
+    cow_matrix_engine(size_type rows, size_type cols);
+    cow_matrix_engine(size_type rows, size_type cols, size_type rowcap, size_type colcap);
+    explicit cow_matrix_engine(shared_engine_type&& eng);
+
+    cow_matrix_engine&  operator =(cow_matrix_engine&& rhs) noexcept = default;
+    cow_matrix_engine&  operator =(cow_matrix_engine const& rhs) noexcept = default;
+    template<class ET2>
+    cow_matrix_engine&  operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    void    reserve(size_type rowcap, size_type colcap);
+    void    resize(size_type rows, size_type cols);
+    void    resize(size_type rows, size_type cols, size_type rowcap, size_type colcap);
+    void    shrink_to_fit();
+
+    //- Element access
+    //
+    reference           operator ()(size_type i, size_type j);
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    //- Layout
+    //
+    pointer             data();
+    const_pointer       data() const noexcept;
+    stride_tuple        stride() const noexcept;
+    bool                is_contiguous() const noexcept;
+
+    //- Sharing
+    //
+    bool                        is_shared() const noexcept;
+    shared_engine_type const&   shared_engine() const noexcept;
+
+    //- Modifiers
+    //
+    void    swap(cow_matrix_engine& other) noexcept;
+    void    swap_columns(size_type c1, size_type c2);
+    void    swap_rows(size_type r1, size_type r2);
+
+  private:
+    using impl_pointer = shared_ptr<shared_engine_type>;
+
+    impl_pointer    mp_impl;        //- Null only when empty
+
+    template<class... ARGS>
+    static impl_pointer         make_impl(ARGS&&... args);
+    static shared_engine_type const&    empty_engine() noexcept;
+
+    shared_engine_type const&   impl() const noexcept;
+    bool                        is_unique() const noexcept;
+    shared_engine_type&         unshare();
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class AT>
+cow_matrix_engine<T,AT>::cow_matrix_engine(size_type rows, size_type cols)
+:   mp_impl(make_impl(rows, cols))
+{}
+
+template<class T, class AT>
+cow_matrix_engine<T,AT>::cow_matrix_engine
+(size_type rows, size_type cols, size_type rowcap, size_type colcap)
+:   mp_impl(make_impl(rows, cols, rowcap, colcap))
+{}
+
+//- Takes over the elements of an existing engine, such as the result of an arithmetic
+//  operation, without copying them.
+//
+template<class T, class AT>
+cow_matrix_engine<T,AT>::cow_matrix_engine(shared_engine_type&& eng)
+:   mp_impl(make_impl(std::move(eng)))
+{}
+
+//- The elements are written into the existing buffer when it is not shared; otherwise they are
+//  written into a new buffer, which replaces the shared one only after the source has been read.
+//
+template<class T, class AT>
+template<class ET2>
+cow_matrix_engine<T,AT>&
+cow_matrix_engine<T,AT>::operator =(ET2 const& rhs)
+{
+    if (is_unique())
+    {
+        *mp_impl = rhs;
+    }
+    else
+    {
+        impl_pointer    p_tmp = make_impl();
+
+        *p_tmp = rhs;
+        mp_impl.swap(p_tmp);
+    }
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::size_type
+cow_matrix_engine<T,AT>::columns() const noexcept
+{
+    return impl().columns();
+}
+
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::size_type
+cow_matrix_engine<T,AT>::rows() const noexcept
+{
+    return impl().rows();
+}
+
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::size_tuple
+cow_matrix_engine<T,AT>::size() const noexcept
+{
+    return impl().size();
+}
+
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::size_type
+cow_matrix_engine<T,AT>::column_capacity() const noexcept
+{
+    return impl().column_capacity();
+}
+
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::size_type
+cow_matrix_engine<T,AT>::row_capacity() const noexcept
+{
+    return impl().row_capacity();
+}
+
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::size_tuple
+cow_matrix_engine<T,AT>::capacity() const noexcept
+{
+    return impl().capacity();
+}
+
+template<class T, class AT>
+void
+cow_matrix_engine<T,AT>::reserve(size_type rowcap, size_type colcap)
+{
+    unshare().reserve(rowcap, colcap);
+}
+
+template<class T, class AT>
+void
+cow_matrix_engine<T,AT>::resize(size_type rows, size_type cols)
+{
+    unshare().resize(rows, cols);
+}
+
+template<class T, class AT>
+void
+cow_matrix_engine<T,AT>::resize(size_type rows, size_type cols, size_type rowcap, size_type colcap)
+{
+    unshare().resize(rows, cols, rowcap, colcap);
+}
+
+template<class T, class AT>
+void
+cow_matrix_engine<T,AT>::shrink_to_fit()
+{
+    unshare().shrink_to_fit();
+}
+
+//----------------
+//- Element access
+//
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::reference
+cow_matrix_engine<T,AT>::operator ()(size_type i, size_type j)
+{
+    return unshare()(i, j);
+}
+
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::const_reference
+cow_matrix_engine<T,AT>::operator ()(size_type i, size_type j) const
+{
+    return impl()(i, j);
+}
+
+//--------
+//- Layout
+//
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::pointer
+cow_matrix_engine<T,AT>::data()
+{
+    return unshare().data();
+}
+
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::const_pointer
+cow_matrix_engine<T,AT>::data() const noexcept
+{
+    return impl().data();
+}
+
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::stride_tuple
+cow_matrix_engine<T,AT>::stride() const noexcept
+{
+    return impl().stride();
+}
+
+template<class T, class AT> inline
+bool
+cow_matrix_engine<T,AT>::is_contiguous() const noexcept
+{
+    return impl().is_contiguous();
+}
+
+//---------
+//- Sharing
+//
+template<class T, class AT> inline
+bool
+cow_matrix_engine<T,AT>::is_shared() const noexcept
+{
+    return mp_impl.use_count() > 1;
+}
+
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::shared_engine_type const&
+cow_matrix_engine<T,AT>::shared_engine() const noexcept
+{
+    return impl();
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class AT> inline
+void
+cow_matrix_engine<T,AT>::swap(cow_matrix_engine& other) noexcept
+{
+    mp_impl.swap(other.mp_impl);
+}
+
+template<class T, class AT>
+void
+cow_matrix_engine<T,AT>::swap_columns(size_type c1, size_type c2)
+{
+    if (c1 != c2)
+    {
+        unshare().swap_columns(c1, c2);
+    }
+}
+
+template<class T, class AT>
+void
+cow_matrix_engine<T,AT>::swap_rows(size_type r1, size_type r2)
+{
+    if (r1 != r2)
+    {
+        unshare().swap_rows(r1, r2);
+    }
+}
+
+//------------------------
+//- Private implementation
+//
+template<class T, class AT>
+template<class... ARGS>
+typename cow_matrix_engine<T,AT>::impl_pointer
+cow_matrix_engine<T,AT>::make_impl(ARGS&&... args)
+{
+    return allocate_shared<shared_engine_type>(allocator_type(), std::forward<ARGS>(args)...);
+}
+
+template<class T, class AT>
+typename cow_matrix_engine<T,AT>::shared_engine_type const&
+cow_matrix_engine<T,AT>::empty_engine() noexcept
+{
+    static shared_engine_type const     empty;
+    return empty;
+}
+
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::shared_engine_type const&
+cow_matrix_engine<T,AT>::impl() const noexcept
+{
+    return (mp_impl) ? *mp_impl : empty_engine();
+}
+
+//- Returns true if this engine holds the only reference to its elements.  A count of one cannot
+//  be raised concurrently by any engine but this one, so observing it means that the buffer is
+//  not shared.  However, use_count() is only a relaxed load, so the acquire fence orders any
+//  subsequent writes after the reads made through the reference that was last released.
+//
+template<class T, class AT> inline
+bool
+cow_matrix_engine<T,AT>::is_unique() const noexcept
+{
+    if (mp_impl  &&  mp_impl.use_count() == 1)
+    {
+        atomic_thread_fence(memory_order_acquire);
+        return true;
+    }
+    return false;
+}
+
+//- Gives this engine its own copy of the elements if they are shared with another engine.
+//
+template<class T, class AT> inline
+typename cow_matrix_engine<T,AT>::shared_engine_type&
+cow_matrix_engine<T,AT>::unshare()
+{
+    if (!mp_impl)
+    {
+        mp_impl = make_impl();
+    }
+    else if (!is_unique())
+    {
+        mp_impl = make_impl(static_cast<shared_engine_type const&>(*mp_impl));
+    }
+    return *mp_impl;
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_COW_ENGINE_HPP_DEFINED
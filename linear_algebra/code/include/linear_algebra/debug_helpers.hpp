@@ -156,23 +156,32 @@ get_type_name(T const&)
     return clean_type_name(string(view.data(), view.size()));
 }
 
+//- These are called from the arithmetic traits, which may be evaluated at compile time; nothing
+//  is printed in that case.
+//
 template<class RT, class O1>
-void
-PrintOperandTypes(string const& loc, O1 const& o1)
+constexpr void
+PrintOperandTypes(char const* loc, O1 const& o1)
 {
-    cout << "in " << loc << endl
-         << "  op1: " << get_type_name(o1) << endl
-         << "  ret: " << get_type_name<RT>() << endl << endl;
+    if (!detail::is_constant_evaluated())
+    {
+        cout << "in " << loc << endl
+             << "  op1: " << get_type_name(o1) << endl
+             << "  ret: " << get_type_name<RT>() << endl << endl;
+    }
 }
 
 template<class RT, class O1, class O2>
-void
-PrintOperandTypes(string const& loc, O1 const& o1, O2 const& o2)
+constexpr void
+PrintOperandTypes(char const* loc, O1 const& o1, O2 const& o2)
 {
-    cout << "in " << loc << endl
-         << "  op1: " << get_type_name(o1) << endl
-         << "  op2: " << get_type_name(o2) << endl
-         << "  ret: " << get_type_name<RT>() << endl << endl;
+    if (!detail::is_constant_evaluated())
+    {
+        cout << "in " << loc << endl
+             << "  op1: " << get_type_name(o1) << endl
+             << "  op2: " << get_type_name(o2) << endl
+             << "  ret: " << get_type_name<RT>() << endl << endl;
+    }
 }
 
 #define PRINT_TYPE(T)       std::cout << #T << ": " << STD_LA::get_type_name<T>() << std::endl
@@ -0,0 +1,394 @@
+//==================================================================================================
+//  File:       diagonal_engines.hpp
+//
+//  Summary:    This header defines owning matrix engines for diagonal matrices and for identity
+//              matrices.  A diagonal matrix stores only the elements of its main diagonal; an
+//              identity matrix stores only its size.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_DIAGONAL_ENGINES_HPP_DEFINED
+#define LINEAR_ALGEBRA_DIAGONAL_ENGINES_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//  Diagonal matrix engine.  An n x n diagonal matrix is represented by the n elements of its main
+//  diagonal; all other elements are implicitly zero.
+//
+//  Elements off the diagonal cannot be written, so the engine is readable; elements of the
+//  diagonal are written through the diagonal_element() member function.
+//==================================================================================================
+//
+template<class T, class AT>
+class diagonal_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using element_array   = std::vector<element_type, allocator_type>;
+
+    //- Construct/copy/destroy
+    //
+    ~diagonal_engine() noexcept = default;
+
+    diagonal_engine();
+    diagonal_engine(diagonal_engine&& rhs) noexcept;
+    diagonal_engine(diagonal_engine const& rhs) = default;
+    explicit diagonal_engine(size_type n);
+
+    diagonal_engine&    operator =(diagonal_engine&& rhs) noexcept;
+    diagonal_engine&    operator =(diagonal_engine const& rhs) = default;
+    template<class ET2>
+    diagonal_engine&    operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    //- Element access
+    //
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    element_type&       diagonal_element(size_type i);
+    element_type const& diagonal_element(size_type i) const;
+
+    //- Diagonal storage access
+    //
+    const_pointer       diagonal_data() const noexcept;
+    pointer             diagonal_data() noexcept;
+
+    //- Modifiers
+    //
+    void    swap(diagonal_engine& rhs) noexcept;
+
+  private:
+    element_array   m_elems;        //- Holds the n diagonal elements
+
+    template<class ET2>
+    void    assign(ET2 const& rhs);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class AT>
+diagonal_engine<T,AT>::diagonal_engine()
+:   m_elems()
+{}
+
+template<class T, class AT>
+diagonal_engine<T,AT>::diagonal_engine(diagonal_engine&& rhs) noexcept
+:   diagonal_engine()
+{
+    rhs.swap(*this);
+}
+
+template<class T, class AT>
+diagonal_engine<T,AT>::diagonal_engine(size_type n)
+:   m_elems(n, value_type())
+{}
+
+template<class T, class AT>
+diagonal_engine<T,AT>&
+diagonal_engine<T,AT>::operator =(diagonal_engine&& rhs) noexcept
+{
+    diagonal_engine     tmp;
+    tmp.swap(rhs);
+    tmp.swap(*this);
+    return *this;
+}
+
+template<class T, class AT>
+template<class ET2>
+diagonal_engine<T,AT>&
+diagonal_engine<T,AT>::operator =(ET2 const& rhs)
+{
+    assign(rhs);
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, class AT> inline
+typename diagonal_engine<T,AT>::size_type
+diagonal_engine<T,AT>::columns() const noexcept
+{
+    return m_elems.size();
+}
+
+template<class T, class AT> inline
+typename diagonal_engine<T,AT>::size_type
+diagonal_engine<T,AT>::rows() const noexcept
+{
+    return m_elems.size();
+}
+
+template<class T, class AT> inline
+typename diagonal_engine<T,AT>::size_tuple
+diagonal_engine<T,AT>::size() const noexcept
+{
+    return size_tuple(m_elems.size(), m_elems.size());
+}
+
+template<class T, class AT> inline
+typename diagonal_engine<T,AT>::size_type
+diagonal_engine<T,AT>::column_capacity() const noexcept
+{
+    return m_elems.size();
+}
+
+template<class T, class AT> inline
+typename diagonal_engine<T,AT>::size_type
+diagonal_engine<T,AT>::row_capacity() const noexcept
+{
+    return m_elems.size();
+}
+
+template<class T, class AT> inline
+typename diagonal_engine<T,AT>::size_tuple
+diagonal_engine<T,AT>::capacity() const noexcept
+{
+    return size_tuple(m_elems.size(), m_elems.size());
+}
+
+//----------------
+//- Element access
+//
+template<class T, class AT> inline
+typename diagonal_engine<T,AT>::const_reference
+diagonal_engine<T,AT>::operator ()(size_type i, size_type j) const
+{
+    return (i == j) ? m_elems[i] : value_type();
+}
+
+template<class T, class AT> inline
+typename diagonal_engine<T,AT>::element_type&
+diagonal_engine<T,AT>::diagonal_element(size_type i)
+{
+    return m_elems[i];
+}
+
+template<class T, class AT> inline
+typename diagonal_engine<T,AT>::element_type const&
+diagonal_engine<T,AT>::diagonal_element(size_type i) const
+{
+    return m_elems[i];
+}
+
+//-------------------------
+//- Diagonal storage access
+//
+template<class T, class AT> inline
+typename diagonal_engine<T,AT>::const_pointer
+diagonal_engine<T,AT>::diagonal_data() const noexcept
+{
+    return m_elems.data();
+}
+
+template<class T, class AT> inline
+typename diagonal_engine<T,AT>::pointer
+diagonal_engine<T,AT>::diagonal_data() noexcept
+{
+    return m_elems.data();
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class AT>
+void
+diagonal_engine<T,AT>::swap(diagonal_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        m_elems.swap(rhs.m_elems);
+    }
+}
+
+//------------------------
+//- Private implementation
+//
+//  Only the diagonal of the source is read; the source must be square.
+//
+template<class T, class AT>
+template<class ET2>
+void
+diagonal_engine<T,AT>::assign(ET2 const& rhs)
+{
+    static_assert(is_matrix_engine_v<ET2>);
+    using src_size_type = typename ET2::size_type;
+
+    size_type const     n = static_cast<size_type>(rhs.rows());
+
+    if (static_cast<size_type>(rhs.columns()) != n)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    diagonal_engine     tmp(n);
+    src_size_type       si;
+    size_type           di;
+
+    for (di = 0, si = 0;  di < n;  ++di, ++si)
+    {
+        tmp.m_elems[di] = static_cast<value_type>(rhs(si, si));
+    }
+
+    tmp.swap(*this);
+}
+
+
+//==================================================================================================
+//  Identity matrix engine.  An n x n identity matrix is represented by its size alone; diagonal
+//  elements read as one and all other elements read as zero.
+//==================================================================================================
+//
+template<class T>
+class identity_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using pointer         = element_type const*;
+    using const_pointer   = element_type const*;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    //- Construct/copy/destroy
+    //
+    ~identity_engine() noexcept = default;
+
+    constexpr identity_engine();
+    constexpr explicit identity_engine(size_type n);
+    constexpr identity_engine(identity_engine&&) noexcept = default;
+    constexpr identity_engine(identity_engine const&) = default;
+
+    constexpr identity_engine&  operator =(identity_engine&&) noexcept = default;
+    constexpr identity_engine&  operator =(identity_engine const&) = default;
+
+    //- Capacity
+    //
+    constexpr size_type     columns() const noexcept;
+    constexpr size_type     rows() const noexcept;
+    constexpr size_tuple    size() const noexcept;
+
+    constexpr size_type     column_capacity() const noexcept;
+    constexpr size_type     row_capacity() const noexcept;
+    constexpr size_tuple    capacity() const noexcept;
+
+    //- Element access
+    //
+    constexpr const_reference   operator ()(size_type i, size_type j) const;
+
+    //- Modifiers
+    //
+    constexpr void      swap(identity_engine& rhs) noexcept;
+
+  private:
+    size_type   m_size;
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T> constexpr
+identity_engine<T>::identity_engine()
+:   m_size(0)
+{}
+
+template<class T> constexpr
+identity_engine<T>::identity_engine(size_type n)
+:   m_size(n)
+{}
+
+//----------
+//- Capacity
+//
+template<class T> constexpr
+typename identity_engine<T>::size_type
+identity_engine<T>::columns() const noexcept
+{
+    return m_size;
+}
+
+template<class T> constexpr
+typename identity_engine<T>::size_type
+identity_engine<T>::rows() const noexcept
+{
+    return m_size;
+}
+
+template<class T> constexpr
+typename identity_engine<T>::size_tuple
+identity_engine<T>::size() const noexcept
+{
+    return size_tuple(m_size, m_size);
+}
+
+template<class T> constexpr
+typename identity_engine<T>::size_type
+identity_engine<T>::column_capacity() const noexcept
+{
+    return m_size;
+}
+
+template<class T> constexpr
+typename identity_engine<T>::size_type
+identity_engine<T>::row_capacity() const noexcept
+{
+    return m_size;
+}
+
+template<class T> constexpr
+typename identity_engine<T>::size_tuple
+identity_engine<T>::capacity() const noexcept
+{
+    return size_tuple(m_size, m_size);
+}
+
+//----------------
+//- Element access
+//
+template<class T> constexpr
+typename identity_engine<T>::const_reference
+identity_engine<T>::operator ()(size_type i, size_type j) const
+{
+    return (i == j) ? value_type(1) : value_type();
+}
+
+//-----------
+//- Modifiers
+//
+template<class T> constexpr
+void
+identity_engine<T>::swap(identity_engine& rhs) noexcept
+{
+    detail::la_swap(m_size, rhs.m_size);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_DIAGONAL_ENGINES_HPP_DEFINED
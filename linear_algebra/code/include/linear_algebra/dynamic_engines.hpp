@@ -31,6 +31,13 @@ class dr_vector_engine
     using difference_type = ptrdiff_t;
     using size_type       = size_t;
 
+    struct released_buffer          //- Returned by release()
+    {
+        pointer     data;
+        size_type   elements;
+        size_type   capacity;
+    };
+
 #ifdef LA_USE_VECTOR_ENGINE_ITERATORS
     using iterator        = detail::vector_iterator<dr_vector_engine>;
     using const_iterator  = detail::vector_const_iterator<dr_vector_engine>;
@@ -47,6 +54,7 @@ class dr_vector_engine
     dr_vector_engine(initializer_list<U> list);
     dr_vector_engine(size_type elems);
     dr_vector_engine(size_type elems, size_type elem_cap);
+    dr_vector_engine(adopt_buffer_t, pointer p_elems, size_type elems, size_type elem_cap);
 
     dr_vector_engine&   operator =(dr_vector_engine&& rhs) noexcept;
     dr_vector_engine&   operator =(dr_vector_engine const& rhs);
@@ -72,17 +80,32 @@ class dr_vector_engine
     void    reserve(size_type cap);
     void    resize(size_type elems);
     void    resize(size_type elems, size_type cap);
+    void    shrink_to_fit();
 
     //- Element access
     //
     reference       operator ()(size_type i);
     const_reference operator ()(size_type i) const;
 
+    //- Layout
+    //
+    pointer         data() noexcept;
+    const_pointer   data() const noexcept;
+    difference_type stride() const noexcept;
+    bool            is_contiguous() const noexcept;
+
     //- Modifiers
     //
     void    swap(dr_vector_engine& rhs) noexcept;
     void    swap_elements(size_type i, size_type j) noexcept;
 
+    released_buffer release() noexcept;
+
+    void    push_back(value_type const& value);
+    void    push_back(value_type&& value);
+    template<class... ARGS>
+    reference   emplace_back(ARGS&&... args);
+
   private:
     pointer         mp_elems;
     size_type       m_elems;
@@ -95,6 +118,7 @@ class dr_vector_engine
     void    assign(ET2 const& rhs);
     void    check_capacity(size_type cap);
     void    check_size(size_type elems);
+    void    grow(size_type elems);
     void    reshape(size_type elems, size_type cap);
 };
 
@@ -143,13 +167,7 @@ dr_vector_engine<T,AT>::dr_vector_engine(initializer_list<U> list)
 ,   m_alloc()
 {
     alloc_new((size_type) list.size(), (size_type) list.size());
-
-    auto    iter = list.begin();
-
-    for (size_t i = 0;  i < list.size();  ++i, ++iter)
-    {
-        mp_elems[i] = static_cast<T>( *iter);
-    }
+    detail::copy_elements(list.begin(), list.size(), mp_elems);
 }
 
 template<class T, class AT> inline
@@ -172,6 +190,28 @@ dr_vector_engine<T,AT>::dr_vector_engine(size_type elems, size_type cap)
     alloc_new(elems, cap);
 }
 
+//- Takes ownership of a buffer of 'cap' constructed elements that was obtained from an allocator
+//  equal to this engine's allocator; the first 'elems' elements become the vector's elements.
+//  The buffer is not copied, and is eventually returned to the allocator.
+//
+template<class T, class AT> inline
+dr_vector_engine<T,AT>::dr_vector_engine(adopt_buffer_t, pointer p_elems, size_type elems, size_type cap)
+:   mp_elems(nullptr)
+,   m_elems(0)
+,   m_elemcap(0)
+,   m_alloc()
+{
+    check_size(elems);
+    if (cap < elems)
+    {
+        throw runtime_error("invalid capacity");
+    }
+
+    mp_elems  = p_elems;
+    m_elems   = elems;
+    m_elemcap = cap;
+}
+
 template<class T, class AT> inline
 dr_vector_engine<T,AT>&
 dr_vector_engine<T,AT>::operator =(dr_vector_engine&& rhs) noexcept
@@ -274,7 +314,14 @@ template<class T, class AT> inline
 void
 dr_vector_engine<T,AT>::resize(size_type elems)
 {
-    reshape(elems, m_elemcap);
+    if (elems > m_elemcap)
+    {
+        reshape(elems, detail::grow_capacity(m_elemcap, elems));
+    }
+    else
+    {
+        reshape(elems, m_elemcap);
+    }
 }
 
 template<class T, class AT> inline
@@ -284,6 +331,21 @@ dr_vector_engine<T,AT>::resize(size_type elems, size_type cap)
     reshape(elems, cap);
 }
 
+template<class T, class AT>
+void
+dr_vector_engine<T,AT>::shrink_to_fit()
+{
+    if (m_elemcap > m_elems)
+    {
+        pointer     p_tmp = (m_elems != 0) ? detail::allocate(m_alloc, m_elems) : nullptr;
+
+        detail::relocate_n(mp_elems, m_elems, p_tmp);
+        detail::deallocate(m_alloc, mp_elems, m_elemcap);
+        mp_elems  = p_tmp;
+        m_elemcap = m_elems;
+    }
+}
+
 //----------------
 //- Element access
 //
@@ -301,6 +363,37 @@ dr_vector_engine<T,AT>::operator ()(size_type i) const
     return mp_elems[i];
 }
 
+//--------
+//- Layout
+//
+template<class T, class AT> inline
+typename dr_vector_engine<T,AT>::pointer
+dr_vector_engine<T,AT>::data() noexcept
+{
+    return mp_elems;
+}
+
+template<class T, class AT> inline
+typename dr_vector_engine<T,AT>::const_pointer
+dr_vector_engine<T,AT>::data() const noexcept
+{
+    return mp_elems;
+}
+
+template<class T, class AT> inline
+typename dr_vector_engine<T,AT>::difference_type
+dr_vector_engine<T,AT>::stride() const noexcept
+{
+    return 1;
+}
+
+template<class T, class AT> inline
+bool
+dr_vector_engine<T,AT>::is_contiguous() const noexcept
+{
+    return true;
+}
+
 //-----------
 //- Modifiers
 //
@@ -323,6 +416,56 @@ dr_vector_engine<T,AT>::swap_elements(size_type i, size_type j) noexcept
     detail::la_swap(mp_elems[i], mp_elems[j]);
 }
 
+//- Relinquishes ownership of the buffer, and leaves the engine empty.  The buffer is returned
+//  with the size and capacity the engine had; it holds 'capacity' constructed elements, of which
+//  the first 'elements' are in use.  The caller becomes responsible for destroying the elements
+//  and returning the buffer to the allocator, or for handing it to another engine with
+//  adopt_buffer.
+//
+template<class T, class AT> inline
+typename dr_vector_engine<T,AT>::released_buffer
+dr_vector_engine<T,AT>::release() noexcept
+{
+    released_buffer const   buf{mp_elems, m_elems, m_elemcap};
+
+    mp_elems  = nullptr;
+    m_elems   = 0;
+    m_elemcap = 0;
+    return buf;
+}
+
+template<class T, class AT> inline
+void
+dr_vector_engine<T,AT>::push_back(value_type const& value)
+{
+    emplace_back(value);
+}
+
+template<class T, class AT> inline
+void
+dr_vector_engine<T,AT>::push_back(value_type&& value)
+{
+    emplace_back(std::move(value));
+}
+
+//- The new element is created before any reallocation takes place, so that the argument may
+//  safely refer to an element of this engine.
+//
+template<class T, class AT>
+template<class... ARGS>
+typename dr_vector_engine<T,AT>::reference
+dr_vector_engine<T,AT>::emplace_back(ARGS&&... args)
+{
+    value_type  elem(std::forward<ARGS>(args)...);
+
+    if (m_elems == m_elemcap)
+    {
+        grow(m_elems + 1);
+    }
+    mp_elems[m_elems] = std::move(elem);
+    return mp_elems[m_elems++];
+}
+
 //------------------------
 //- Private implementation
 //
@@ -339,22 +482,37 @@ dr_vector_engine<T,AT>::alloc_new(size_type new_size, size_type new_cap)
     m_elemcap = new_cap;
 }
 
+//- Assignment reuses the existing buffer whenever the source fits within the current capacity,
+//  and otherwise allocates only as many elements as the source actually holds.
+//
 template<class T, class AT>
 void
 dr_vector_engine<T,AT>::assign(dr_vector_engine const& rhs)
 {
     if (&rhs == this) return;
 
-    size_type   old_n = (size_type)(m_elemcap);
-    size_type   new_n = (size_type)(rhs.m_elemcap);
-    pointer     p_tmp = detail::allocate(m_alloc, new_n, rhs.mp_elems);
+    if (rhs.m_elems > m_elemcap)
+    {
+        size_type   old_n = (size_type)(m_elemcap);
+        size_type   new_n = (size_type)(rhs.m_elems);
+        pointer     p_tmp = detail::allocate(m_alloc, new_n, rhs.mp_elems);
 
-    detail::deallocate(m_alloc, mp_elems, old_n);
-    mp_elems  = p_tmp;
-    m_elems   = rhs.m_elems;
-    m_elemcap = rhs.m_elemcap;
+        detail::deallocate(m_alloc, mp_elems, old_n);
+        mp_elems  = p_tmp;
+        m_elemcap = new_n;
+    }
+    else
+    {
+        detail::copy_elements(rhs.mp_elems, rhs.m_elems, mp_elems);
+    }
+    m_elems = rhs.m_elems;
 }
 
+//- The source's elements are written directly into the existing buffer when they fit, unless the
+//  source is a view, which might refer to this engine; in that case, as when the buffer is too
+//  small, they are written into a temporary.  Elements of a source exposing a strided layout are
+//  read through its data pointer, and copied in bulk when they are contiguous.
+//
 template<class T, class AT>
 template<class ET2>
 void
@@ -363,28 +521,54 @@ dr_vector_engine<T,AT>::assign(ET2 const& rhs)
     static_assert(is_vector_engine_v<ET2>);
     using src_size_type = typename ET2::size_type;
 
-    size_type           elems = (size_type) rhs.elements();
-    dr_vector_engine    tmp(elems);
+    size_type const     elems   = (size_type) rhs.elements();
+    bool const          use_tmp = detail::is_view_engine_v<ET2>  ||  elems > m_elemcap;
+    dr_vector_engine    tmp;
+
+    if (use_tmp)
+    {
+        tmp.alloc_new(elems, elems);
+    }
+    else
+    {
+        check_size(elems);
+    }
+
+    pointer const   p_dst = (use_tmp) ? tmp.mp_elems : mp_elems;
 
-    if constexpr(is_same_v<size_type, src_size_type>)
+    if constexpr (detail::has_strided_layout_v<ET2>)
     {
-        for (size_type i = 0;  i < elems;  ++i)
+        if (rhs.stride() == 1)
+        {
+            detail::copy_elements(rhs.data(), elems, p_dst);
+        }
+        else
         {
-            tmp(i) = rhs(i);
+            auto const  p_src = rhs.data();
+            auto const  step  = rhs.stride();
+
+            for (size_type di = 0;  di < elems;  ++di)
+            {
+                p_dst[di] = static_cast<T>(p_src[(difference_type) di * step]);
+            }
         }
     }
     else
     {
-        src_size_type  si;
+        src_size_type   si;
         size_type       di;
 
         for (di = 0, si = 0;  di < elems;  ++di, ++si)
         {
-            tmp(di) = rhs(si);
+            p_dst[di] = rhs(si);
         }
     }
 
-    tmp.swap(*this);
+    if (use_tmp)
+    {
+        tmp.swap(*this);
+    }
+    m_elems = elems;
 }
 
 template<class T, class AT>
@@ -407,6 +591,22 @@ dr_vector_engine<T,AT>::check_size(size_type elems)
     }
 }
 
+//- Reallocates so that capacity is at least 'elems', preserving the current elements.  Unlike
+//  reshape(), this does not require the engine to be non-empty.
+//
+template<class T, class AT>
+void
+dr_vector_engine<T,AT>::grow(size_type elems)
+{
+    size_type const     new_cap = detail::grow_capacity(m_elemcap, elems);
+    pointer             p_tmp   = detail::allocate(m_alloc, new_cap);
+
+    detail::relocate_n(mp_elems, m_elems, p_tmp);
+    detail::deallocate(m_alloc, mp_elems, m_elemcap);
+    mp_elems  = p_tmp;
+    m_elemcap = new_cap;
+}
+
 template<class T, class AT>
 void
 dr_vector_engine<T,AT>::reshape(size_type elems, size_type cap)
@@ -416,10 +616,7 @@ dr_vector_engine<T,AT>::reshape(size_type elems, size_type cap)
         dr_vector_engine    tmp(elems, cap);
         size_type const    dst_elems = min(elems, m_elems);
 
-        for (size_type i = 0;  i < dst_elems;  ++i)
-        {
-            tmp.mp_elems[i] = mp_elems[i];
-        }
+        detail::relocate_n(mp_elems, dst_elems, tmp.mp_elems);
         tmp.swap(*this);
     }
     else
@@ -451,6 +648,16 @@ class dr_matrix_engine
     using difference_type = ptrdiff_t;
     using size_type       = size_t;
     using size_tuple      = tuple<size_type, size_type>;
+    using stride_tuple    = tuple<difference_type, difference_type>;
+
+    struct released_buffer          //- Returned by release()
+    {
+        pointer     data;
+        size_type   rows;
+        size_type   columns;
+        size_type   row_capacity;
+        size_type   column_capacity;
+    };
 
     //- Construct/copy/destroy
     //
@@ -461,6 +668,8 @@ class dr_matrix_engine
     dr_matrix_engine(dr_matrix_engine const& rhs);
     dr_matrix_engine(size_type rows, size_type cols);
     dr_matrix_engine(size_type rows, size_type cols, size_type rowcap, size_type colcap);
+    dr_matrix_engine(adopt_buffer_t, pointer p_elems, size_type rows, size_type cols,
+                     size_type rowcap, size_type colcap);
 
     dr_matrix_engine&   operator =(dr_matrix_engine&&) noexcept;
     dr_matrix_engine&   operator =(dr_matrix_engine const&);
@@ -480,18 +689,31 @@ class dr_matrix_engine
     void    reserve(size_type rowcap, size_type colcap);
     void    resize(size_type rows, size_type cols);
     void    resize(size_type rows, size_type cols, size_type rowcap, size_type colcap);
+    void    shrink_to_fit();
 
     //- Element access
     //
     reference           operator ()(size_type i, size_type j);
     const_reference     operator ()(size_type i, size_type j) const;
 
+    //- Layout
+    //
+    pointer             data() noexcept;
+    const_pointer       data() const noexcept;
+    stride_tuple        stride() const noexcept;
+    bool                is_contiguous() const noexcept;
+
     //- Modifiers
     //
     void    swap(dr_matrix_engine& other) noexcept;
     void    swap_columns(size_type c1, size_type c2) noexcept;
     void    swap_rows(size_type r1, size_type r2) noexcept;
 
+    released_buffer release() noexcept;
+
+    template<class ET2>
+    void    append_row(ET2 const& row);
+
   private:
     pointer         mp_elems;       //- For exposition; data buffer
     size_type       m_rows;
@@ -504,6 +726,7 @@ class dr_matrix_engine
     void    assign(dr_matrix_engine const& rhs);
     void    check_capacities(size_type rowcap, size_type colcap);
     void    check_sizes(size_type rows, size_type cols);
+    void    reallocate(size_type rowcap, size_type colcap);
     void    reshape(size_type rows, size_type cols, size_type rowcap, size_type colcap);
 };
 
@@ -513,7 +736,7 @@ class dr_matrix_engine
 template<class T, class AT> inline
 dr_matrix_engine<T,AT>::~dr_matrix_engine() noexcept
 {
-    delete [] mp_elems;
+    detail::deallocate(m_alloc, mp_elems, (size_t)(m_rowcap*m_colcap));
 }
 
 template<class T, class AT>
@@ -575,6 +798,34 @@ dr_matrix_engine<T,AT>::dr_matrix_engine
     alloc_new(rows, cols, rowcap, colcap);
 }
 
+//- Takes ownership of a buffer of rowcap*colcap constructed elements that was obtained from an
+//  allocator equal to this engine's allocator.  Element (i, j) is at offset i*colcap + j, so that
+//  colcap is the leading dimension of the buffer.  The buffer is not copied, and is eventually
+//  returned to the allocator.
+//
+template<class T, class AT>
+dr_matrix_engine<T,AT>::dr_matrix_engine
+(adopt_buffer_t, pointer p_elems, size_type rows, size_type cols, size_type rowcap, size_type colcap)
+:   mp_elems(nullptr)
+,   m_rows(0)
+,   m_cols(0)
+,   m_rowcap(0)
+,   m_colcap(0)
+,   m_alloc()
+{
+    check_sizes(rows, cols);
+    if (rowcap < rows  ||  colcap < cols)
+    {
+        throw runtime_error("invalid capacity");
+    }
+
+    mp_elems = p_elems;
+    m_rows   = rows;
+    m_cols   = cols;
+    m_rowcap = rowcap;
+    m_colcap = colcap;
+}
+
 template<class T, class AT>
 dr_matrix_engine<T,AT>&
 dr_matrix_engine<T,AT>::operator =(dr_matrix_engine&& rhs) noexcept
@@ -593,6 +844,11 @@ dr_matrix_engine<T,AT>::operator =(dr_matrix_engine const& rhs)
     return *this;
 }
 
+//- The existing buffer is reused when the source fits within the current capacities, unless the
+//  source is a view, which might refer to this engine; in that case the elements are first
+//  copied into a temporary.  Elements of a dense owning source are copied in bulk, as are those
+//  of any other source exposing a strided layout whose rows are contiguous.
+//
 template<class T, class AT>
 template<class ET2>
 dr_matrix_engine<T,AT>&
@@ -603,8 +859,58 @@ dr_matrix_engine<T,AT>::operator =(ET2 const& rhs)
 
     size_type           rows = (size_type) rhs.rows();
     size_type           cols = (size_type) rhs.columns();
+
+    if constexpr (detail::is_dense_owning_engine_v<ET2>)
+    {
+        if (rows > m_rowcap  ||  cols > m_colcap)
+        {
+            dr_matrix_engine(rows, cols).swap(*this);
+        }
+        else
+        {
+            check_sizes(rows, cols);
+        }
+        m_rows = rows;
+        m_cols = cols;
+
+        detail::copy_rows(rhs.data(), (size_t) get<0>(rhs.stride()),
+                          mp_elems, (size_t) m_colcap, (size_t) rows, (size_t) cols);
+        return *this;
+    }
+    else if (!detail::is_view_engine_v<ET2>  &&  rows <= m_rowcap  &&  cols <= m_colcap)
+    {
+        check_sizes(rows, cols);
+        m_rows = rows;
+        m_cols = cols;
+
+        src_size_type   si, sj;
+        size_type       di, dj;
+
+        for (di = 0, si = 0;  di < rows;  ++di, ++si)
+        {
+            for (dj = 0, sj = 0;  dj < cols;  ++dj, ++sj)
+            {
+                (*this)(di, dj) = rhs(si, sj);
+            }
+        }
+        return *this;
+    }
+
     dr_matrix_engine    tmp(rows, cols);
 
+    if constexpr (detail::has_strided_layout_v<ET2>)
+    {
+        auto const  [rs, cs] = rhs.stride();
+
+        if (cs == 1  &&  rs >= 0)
+        {
+            detail::copy_rows(rhs.data(), (size_t) rs, tmp.mp_elems, (size_t) tmp.m_colcap,
+                              (size_t) rows, (size_t) cols);
+            tmp.swap(*this);
+            return *this;
+        }
+    }
+
     src_size_type   si, sj;
     size_type       di, dj;
 
@@ -677,7 +983,10 @@ template<class T, class AT>
 void
 dr_matrix_engine<T,AT>::resize(size_type rows, size_type cols)
 {
-    reshape(rows, cols, m_rowcap, m_colcap);
+    size_type const     rowcap = (rows > m_rowcap) ? detail::grow_capacity(m_rowcap, rows) : m_rowcap;
+    size_type const     colcap = (cols > m_colcap) ? detail::grow_capacity(m_colcap, cols) : m_colcap;
+
+    reshape(rows, cols, rowcap, colcap);
 }
 
 template<class T, class AT>
@@ -687,6 +996,20 @@ dr_matrix_engine<T,AT>::resize(size_type rows, size_type cols, size_type rowcap,
     reshape(rows, cols, rowcap, colcap);
 }
 
+template<class T, class AT>
+void
+dr_matrix_engine<T,AT>::shrink_to_fit()
+{
+    if (m_rows == 0  ||  m_cols == 0)
+    {
+        dr_matrix_engine().swap(*this);
+    }
+    else if (m_rowcap > m_rows  ||  m_colcap > m_cols)
+    {
+        reallocate(m_rows, m_cols);
+    }
+}
+
 //----------------
 //- Element access
 //
@@ -704,6 +1027,40 @@ dr_matrix_engine<T,AT>::operator ()(size_type i, size_type j) const
     return mp_elems[i*m_colcap + j];
 }
 
+//--------
+//- Layout
+//
+template<class T, class AT> inline
+typename dr_matrix_engine<T,AT>::pointer
+dr_matrix_engine<T,AT>::data() noexcept
+{
+    return mp_elems;
+}
+
+template<class T, class AT> inline
+typename dr_matrix_engine<T,AT>::const_pointer
+dr_matrix_engine<T,AT>::data() const noexcept
+{
+    return mp_elems;
+}
+
+//- Rows are separated by the column capacity, so the elements are contiguous only when there
+//  is no spare capacity at the end of each row.
+//
+template<class T, class AT> inline
+typename dr_matrix_engine<T,AT>::stride_tuple
+dr_matrix_engine<T,AT>::stride() const noexcept
+{
+    return stride_tuple(static_cast<difference_type>(m_colcap), 1);
+}
+
+template<class T, class AT> inline
+bool
+dr_matrix_engine<T,AT>::is_contiguous() const noexcept
+{
+    return m_cols == m_colcap  ||  m_rows <= 1;
+}
+
 //-----------
 //- Modifiers
 //
@@ -747,6 +1104,71 @@ dr_matrix_engine<T,AT>::swap_rows(size_type r1, size_type r2) noexcept
     }
 }
 
+//- Relinquishes ownership of the buffer, and leaves the engine empty.  The buffer is returned
+//  with the sizes and capacities the engine had; it holds row_capacity*column_capacity
+//  constructed elements, laid out as described for the adopting constructor.  The caller becomes
+//  responsible for destroying the elements and returning the buffer to the allocator, or for
+//  handing it to another engine with adopt_buffer.
+//
+template<class T, class AT>
+typename dr_matrix_engine<T,AT>::released_buffer
+dr_matrix_engine<T,AT>::release() noexcept
+{
+    released_buffer const   buf{mp_elems, m_rows, m_cols, m_rowcap, m_colcap};
+
+    mp_elems = nullptr;
+    m_rows   = 0;
+    m_cols   = 0;
+    m_rowcap = 0;
+    m_colcap = 0;
+    return buf;
+}
+
+//- Appends a copy of the vector engine 'row' as a new last row.  Row capacity grows
+//  geometrically, so that building a matrix one row at a time costs amortized linear time.  If
+//  the matrix is empty, its column count is taken from 'row'; otherwise they must agree.
+//
+template<class T, class AT>
+template<class ET2>
+void
+dr_matrix_engine<T,AT>::append_row(ET2 const& row)
+{
+    static_assert(is_vector_engine_v<ET2>);
+    using src_size_type = typename ET2::size_type;
+
+    size_type const     cols = (size_type) row.elements();
+
+    if (m_rows == 0)
+    {
+        check_sizes(1, cols);
+        m_cols = cols;
+    }
+    else if (cols != m_cols)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    if (m_rows == m_rowcap  ||  m_cols > m_colcap)
+    {
+        size_type const     rowcap = (m_rows == m_rowcap) ? detail::grow_capacity(m_rowcap, m_rows + 1)
+                                                          : m_rowcap;
+        reallocate(rowcap, max(m_cols, m_colcap));
+    }
+
+    //- The source is read only after reallocation, and only rows below the new one are moved,
+    //  so 'row' may be a view of this engine.
+    //
+    pointer         p_dst = mp_elems + m_rows*m_colcap;
+    src_size_type   sj;
+    size_type       dj;
+
+    for (dj = 0, sj = 0;  dj < cols;  ++dj, ++sj)
+    {
+        p_dst[dj] = static_cast<value_type>(row(sj));
+    }
+    ++m_rows;
+}
+
 //------------------------
 //- Private implementation
 //
@@ -766,22 +1188,31 @@ dr_matrix_engine<T,AT>::alloc_new(size_type rows, size_type cols, size_type rowc
     m_colcap = colcap;
 }
 
+//- Assignment reuses the existing buffer whenever the source fits within the current capacities,
+//  and otherwise allocates only as many elements as the source actually holds.
+//
 template<class T, class AT>
 void
 dr_matrix_engine<T,AT>::assign(dr_matrix_engine const& rhs)
 {
     if (&rhs == this) return;
 
-    size_t      old_n = (size_t)(m_rowcap*m_colcap);
-    size_t      new_n = (size_t)(rhs.m_rowcap*rhs.m_colcap);
-    pointer     p_tmp = detail::allocate(m_alloc, new_n, rhs.mp_elems);
+    if (rhs.m_rows > m_rowcap  ||  rhs.m_cols > m_colcap)
+    {
+        size_t      old_n = (size_t)(m_rowcap*m_colcap);
+        size_t      new_n = (size_t)(rhs.m_rows*rhs.m_cols);
+        pointer     p_tmp = detail::allocate(m_alloc, new_n);
+
+        detail::deallocate(m_alloc, mp_elems, old_n);
+        mp_elems = p_tmp;
+        m_rowcap = rhs.m_rows;
+        m_colcap = rhs.m_cols;
+    }
 
-    detail::deallocate(m_alloc, mp_elems, old_n);
-    mp_elems = p_tmp;
-    m_rows   = rhs.m_rows;
-    m_cols   = rhs.m_cols;
-    m_rowcap = rhs.m_rowcap;
-    m_colcap = rhs.m_colcap;
+    detail::copy_rows(rhs.mp_elems, (size_t) rhs.m_colcap, mp_elems, (size_t) m_colcap,
+                      (size_t) rhs.m_rows, (size_t) rhs.m_cols);
+    m_rows = rhs.m_rows;
+    m_cols = rhs.m_cols;
 }
 
 template<class T, class AT>
@@ -804,6 +1235,34 @@ dr_matrix_engine<T,AT>::check_sizes(size_type rows, size_type cols)
     }
 }
 
+//- Replaces the buffer with one of the given capacities, which must be at least the current
+//  sizes, and moves the current elements into it.  When the column capacity is unchanged the
+//  rows are contiguous in both buffers and are moved all at once.
+//
+template<class T, class AT>
+void
+dr_matrix_engine<T,AT>::reallocate(size_type rowcap, size_type colcap)
+{
+    pointer     p_tmp = detail::allocate(m_alloc, (size_t)(rowcap*colcap));
+
+    if (colcap == m_colcap)
+    {
+        detail::relocate_n(mp_elems, (size_t)(m_rows*m_colcap), p_tmp);
+    }
+    else
+    {
+        for (size_type i = 0;  i < m_rows;  ++i)
+        {
+            detail::relocate_n(mp_elems + i*m_colcap, (size_t) m_cols, p_tmp + i*colcap);
+        }
+    }
+
+    detail::deallocate(m_alloc, mp_elems, (size_t)(m_rowcap*m_colcap));
+    mp_elems = p_tmp;
+    m_rowcap = rowcap;
+    m_colcap = colcap;
+}
+
 template<class T, class AT>
 void
 dr_matrix_engine<T,AT>::reshape(size_type rows, size_type cols, size_type rowcap, size_type colcap)
@@ -816,10 +1275,7 @@ dr_matrix_engine<T,AT>::reshape(size_type rows, size_type cols, size_type rowcap
 
         for (size_type i = 0;  i < dst_rows;  ++i)
         {
-            for (size_type j = 0;  j < dst_cols;  ++j)
-            {
-                tmp.mp_elems[i*m_colcap + j] = mp_elems[i*m_colcap + j];
-            }
+            detail::relocate_n(mp_elems + i*m_colcap, (size_t) dst_cols, tmp.mp_elems + i*tmp.m_colcap);
         }
         tmp.swap(*this);
     }
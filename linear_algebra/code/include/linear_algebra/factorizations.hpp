@@ -0,0 +1,1306 @@
+//==================================================================================================
+//  File:       factorizations.hpp
+//
+//  Summary:    This header defines blocked factorizations of dense matrices (LU, Cholesky, and
+//              QR), along with the solvers, determinants, inverses, and least-squares solutions
+//              that are built on them.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_FACTORIZATIONS_HPP_DEFINED
+#define LINEAR_ALGEBRA_FACTORIZATIONS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Right-looking blocked LU factorization with partial pivoting, P*A = L*U, of the n x n matrix
+//  whose rows are lda elements apart.  For each panel of lu_block_size columns, the panel is
+//  factored column by column on the calling thread (swapping entire rows as pivots are chosen),
+//  the block row of U to its right is found by forward substitution, and the trailing matrix is
+//  updated with a GEMM; only those last two steps, which do most of the work, are divided among
+//  threads.  Element perm[i] is set to the row of A that became row i of P*A.
+//
+//  Zero pivots do not stop the factorization, so that the determinant of a singular matrix can
+//  still be found; the function returns the number of row interchanges, and sets 'singular'.
+//==================================================================================================
+//
+inline constexpr size_t     lu_block_size = 64;
+
+template<class T>
+size_t
+blocked_lu_in_place(size_t n, T* p_a, ptrdiff_t lda, size_t* p_perm, bool& singular)
+{
+    auto    row = [p_a, lda](size_t i) -> T* { return p_a + (ptrdiff_t) i*lda; };
+
+    size_t  swaps = 0;
+
+    singular = false;
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        p_perm[i] = i;
+    }
+
+    for (size_t k0 = 0;  k0 < n;  k0 += lu_block_size)
+    {
+        size_t const    kb = min(lu_block_size, n - k0);
+        size_t const    c0 = k0 + kb;
+
+        //- Factor the panel of columns [k0, c0).
+        //
+        for (size_t k = k0;  k < c0;  ++k)
+        {
+            size_t  p = k;
+
+            for (size_t i = k + 1;  i < n;  ++i)
+            {
+                if (abs(row(i)[k]) > abs(row(p)[k])) p = i;
+            }
+
+            if (row(p)[k] == T())
+            {
+                singular = true;
+                continue;
+            }
+
+            if (p != k)
+            {
+                swap_ranges(row(k), row(k) + n, row(p));
+                detail::la_swap(p_perm[k], p_perm[p]);
+                ++swaps;
+            }
+
+            T const* const  p_uk  = row(k);
+            T const         pivot = p_uk[k];
+
+            for (size_t i = k + 1;  i < n;  ++i)
+            {
+                T* const    p_ai = row(i);
+                T const     l    = (p_ai[k] /= pivot);
+
+                for (size_t j = k + 1;  j < c0;  ++j)
+                {
+                    p_ai[j] -= l * p_uk[j];
+                }
+            }
+        }
+
+        if (c0 == n) break;
+
+        //- Find the block row U12 = inv(L11) * A12 by forward substitution, with its columns
+        //  divided among the tasks.
+        //
+        parallel_for(c0, n, (n - c0) * kb * kb / 2, [=](size_t first, size_t last)
+        {
+            for (size_t i = k0 + 1;  i < c0;  ++i)
+            {
+                T* const    p_ai = row(i);
+
+                for (size_t p = k0;  p < i;  ++p)
+                {
+                    T const             l    = p_ai[p];
+                    T const* const      p_up = row(p);
+
+                    for (size_t j = first;  j < last;  ++j)
+                    {
+                        p_ai[j] -= l * p_up[j];
+                    }
+                }
+            }
+        });
+
+        //- Update the trailing matrix, A22 -= L21 * U12.
+        //
+        strided_gemm_subtract(n - c0, n - c0, kb,
+                              row(c0) + k0, lda, ptrdiff_t(1),
+                              row(k0) + c0, lda,
+                              row(c0) + c0, lda);
+    }
+
+    return swaps;
+}
+
+}       //- detail namespace
+
+
+//==================================================================================================
+//  LU factorization with partial pivoting of a square matrix, P*A = L*U, where L is unit lower
+//  triangular and U is upper triangular.  The factors are held packed in a single matrix, with
+//  the strictly lower triangle holding L and the upper triangle holding U; the permutation is
+//  held as a vector whose element i is the row of A that is row i of P*A.
+//
+//  The factorization of an n x n matrix takes time proportional to n^3, most of it in the GEMM
+//  updates of the trailing matrix, which are divided among threads.  Constructing from an rvalue
+//  dynamic matrix factors it in place, without allocating a copy.  A singular matrix can be
+//  factored, and its determinant is then zero, but solve() and inverse() throw an exception.
+//==================================================================================================
+//
+template<class T, class AT>
+class lu_factorization
+{
+  public:
+    //- Types
+    //
+    using element_type     = T;
+    using matrix_type      = matrix<dr_matrix_engine<T, AT>>;
+    using size_type        = typename matrix_type::size_type;
+    using permutation_type = std::vector<size_type>;
+
+    //- Construct/copy/destroy
+    //
+    ~lu_factorization() noexcept = default;
+
+    lu_factorization() = default;
+    lu_factorization(lu_factorization&&) noexcept = default;
+    lu_factorization(lu_factorization const&) = default;
+    template<class ET2, class OT2>
+    explicit lu_factorization(matrix<ET2, OT2> const& a);
+    explicit lu_factorization(matrix_type&& a);
+
+    lu_factorization&   operator =(lu_factorization&&) noexcept = default;
+    lu_factorization&   operator =(lu_factorization const&) = default;
+
+    //- Factors
+    //
+    size_type                   size() const noexcept;
+    matrix_type const&          packed() const noexcept;
+    permutation_type const&     permutation() const noexcept;
+    bool                        is_singular() const noexcept;
+
+    //- Results
+    //
+    element_type    determinant() const;
+    matrix_type     inverse() const;
+
+    template<class ET2, class OT2>
+    auto    solve(vector<ET2, OT2> const& b) const;
+    template<class ET2, class OT2>
+    auto    solve(matrix<ET2, OT2> const& b) const;
+
+  private:
+    matrix_type         m_lu;
+    permutation_type    m_perm;
+    size_t              m_swaps = 0;
+    bool                m_singular = false;
+
+    void    factor();
+    template<class R>
+    void    solve_in_place(std::vector<R>& x, size_t nrhs) const;
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class AT>
+template<class ET2, class OT2>
+lu_factorization<T,AT>::lu_factorization(matrix<ET2, OT2> const& a)
+:   m_lu(a)
+,   m_perm()
+{
+    factor();
+}
+
+template<class T, class AT>
+lu_factorization<T,AT>::lu_factorization(matrix_type&& a)
+:   m_lu(std::move(a))
+,   m_perm()
+{
+    factor();
+}
+
+//---------
+//- Factors
+//
+template<class T, class AT> inline
+typename lu_factorization<T,AT>::size_type
+lu_factorization<T,AT>::size() const noexcept
+{
+    return m_lu.rows();
+}
+
+template<class T, class AT> inline
+typename lu_factorization<T,AT>::matrix_type const&
+lu_factorization<T,AT>::packed() const noexcept
+{
+    return m_lu;
+}
+
+template<class T, class AT> inline
+typename lu_factorization<T,AT>::permutation_type const&
+lu_factorization<T,AT>::permutation() const noexcept
+{
+    return m_perm;
+}
+
+template<class T, class AT> inline
+bool
+lu_factorization<T,AT>::is_singular() const noexcept
+{
+    return m_singular;
+}
+
+//---------
+//- Results
+//
+template<class T, class AT>
+typename lu_factorization<T,AT>::element_type
+lu_factorization<T,AT>::determinant() const
+{
+    element_type    det = (m_swaps % 2 == 0) ? element_type(1) : element_type(-1);
+
+    for (size_type i = 0;  i < size();  ++i)
+    {
+        det *= m_lu(i, i);
+    }
+    return det;
+}
+
+template<class T, class AT>
+typename lu_factorization<T,AT>::matrix_type
+lu_factorization<T,AT>::inverse() const
+{
+    size_t const            n = static_cast<size_t>(size());
+    std::vector<T>          x(n * n);
+    matrix_type             mr(size(), size());
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        x[i*n + i] = T(1);
+    }
+
+    solve_in_place(x, n);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            mr(static_cast<size_type>(i), static_cast<size_type>(j)) = x[i*n + j];
+        }
+    }
+    return mr;
+}
+
+template<class T, class AT>
+template<class ET2, class OT2>
+auto
+lu_factorization<T,AT>::solve(vector<ET2, OT2> const& b) const
+{
+    using element_type_r = common_type_t<T, typename ET2::element_type>;
+
+    auto    x = detail::rhs_to_array<element_type_r>(b, static_cast<size_t>(size()));
+    solve_in_place(x, detail::rhs_count(b));
+    return detail::array_to_solution(b, x);
+}
+
+template<class T, class AT>
+template<class ET2, class OT2>
+auto
+lu_factorization<T,AT>::solve(matrix<ET2, OT2> const& b) const
+{
+    using element_type_r = common_type_t<T, typename ET2::element_type>;
+
+    auto    x = detail::rhs_to_array<element_type_r>(b, static_cast<size_t>(size()));
+    solve_in_place(x, detail::rhs_count(b));
+    return detail::array_to_solution(b, x);
+}
+
+//------------------------
+//- Private implementation
+//
+template<class T, class AT>
+void
+lu_factorization<T,AT>::factor()
+{
+    if (m_lu.rows() != m_lu.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_t const            n = static_cast<size_t>(m_lu.rows());
+    std::vector<size_t>     perm(n);
+
+    if (n != 0)
+    {
+        auto&   eng = m_lu.engine();
+
+        m_swaps = detail::blocked_lu_in_place(n, eng.data(), std::get<0>(eng.stride()),
+                                              perm.data(), m_singular);
+    }
+    m_perm.assign(perm.begin(), perm.end());
+}
+
+//- Overwrites the n x nrhs row-major array x of right-hand sides with the solution, by applying
+//  the row interchanges and then solving with the triangular factors L and U in turn.
+//
+template<class T, class AT>
+template<class R>
+void
+lu_factorization<T,AT>::solve_in_place(std::vector<R>& x, size_t nrhs) const
+{
+    using engine_type = dr_matrix_engine<T, AT>;
+
+    if (m_singular)
+    {
+        throw runtime_error("singular matrix");
+    }
+
+    size_t const        n = m_perm.size();
+    std::vector<R>      px(x.size());
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        copy_n(x.data() + m_perm[i]*nrhs, nrhs, px.data() + i*nrhs);
+    }
+
+    triangular_engine<engine_type, lower_triangle_tag, unit_diagonal_tag>       l(m_lu.engine());
+    triangular_engine<engine_type, upper_triangle_tag, nonunit_diagonal_tag>    u(m_lu.engine());
+
+    detail::solve_triangular_in_place(l, px.data(), nrhs);
+    detail::solve_triangular_in_place(u, px.data(), nrhs);
+    x.swap(px);
+}
+
+
+//==================================================================================================
+//  Free functions for general square matrices, built on the LU factorization.  These have the
+//  same names as the solvers for structured engines in linear_solvers.hpp, which are chosen in
+//  preference to them by overload resolution.
+//==================================================================================================
+//
+template<class ET1, class OT1>
+auto
+lu_factor(matrix<ET1, OT1> const& a)
+{
+    using element_type = detail::factor_element_t<typename ET1::value_type>;
+
+    return lu_factorization<element_type>(a);
+}
+
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+solve(matrix<ET1, OT1> const& a, vector<ET2, OT2> const& b)
+{
+    return lu_factor(a).solve(b);
+}
+
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+solve(matrix<ET1, OT1> const& a, matrix<ET2, OT2> const& b)
+{
+    return lu_factor(a).solve(b);
+}
+
+template<class ET1, class OT1>
+auto
+determinant(matrix<ET1, OT1> const& a)
+{
+    return lu_factor(a).determinant();
+}
+
+template<class ET1, class OT1>
+auto
+inverse(matrix<ET1, OT1> const& a)
+{
+    return lu_factor(a).inverse();
+}
+
+
+namespace detail {
+//==================================================================================================
+//  Returns the dot product of the n elements of x and y, which are xs and ys elements apart.  For
+//  unit strides, the sum is accumulated in dot_lanes independent partial sums, which compilers
+//  can vectorize without reassociating floating-point additions.
+//==================================================================================================
+//
+inline constexpr size_t     dot_lanes = 8;
+
+template<class T>
+T
+strided_dot(size_t n, T const* p_x, ptrdiff_t xs, T const* p_y, ptrdiff_t ys)
+{
+    T   sum{};
+
+    if (xs == 1  &&  ys == 1)
+    {
+        T       lanes[dot_lanes] = {};
+        size_t  k = 0;
+
+        for (;  k + dot_lanes <= n;  k += dot_lanes)
+        {
+            for (size_t l = 0;  l < dot_lanes;  ++l)
+            {
+                lanes[l] += p_x[k + l] * p_y[k + l];
+            }
+        }
+        for (;  k < n;  ++k)
+        {
+            sum += p_x[k] * p_y[k];
+        }
+        for (size_t l = 0;  l < dot_lanes;  ++l)
+        {
+            sum += lanes[l];
+        }
+    }
+    else
+    {
+        for (size_t k = 0;  k < n;  ++k)
+        {
+            sum += p_x[(ptrdiff_t) k*xs] * p_y[(ptrdiff_t) k*ys];
+        }
+    }
+    return sum;
+}
+
+//==================================================================================================
+//  Left-looking blocked Cholesky factorization, A = L*L', of the n x n symmetric positive-definite
+//  matrix whose element (i, j) is at p_a[i*rs + j*cs].  Only the lower triangle is read, and it
+//  is overwritten with L; the strict upper triangle is not accessed, and no workspace is
+//  allocated.
+//
+//  For each panel of cholesky_block_size columns, the diagonal block of the panel is first
+//  updated with the product of the columns of L to its left and factored, on the calling thread.
+//  Each row below the diagonal block is then updated in the same way (the GEMM step, which does
+//  most of the work) and solved against the factored diagonal block.  Those rows are independent,
+//  so they are divided among threads that are started once per panel.  Each element is updated
+//  with a dot product of two rows of L, which are contiguous for row-major storage.
+//==================================================================================================
+//
+inline constexpr size_t     cholesky_block_size = 64;
+
+template<class T>
+void
+blocked_cholesky_in_place(size_t n, T* p_a, ptrdiff_t rs, ptrdiff_t cs)
+{
+    auto    elem = [p_a, rs, cs](size_t i, size_t j) -> T&
+    {
+        return p_a[(ptrdiff_t) i*rs + (ptrdiff_t) j*cs];
+    };
+
+    for (size_t k0 = 0;  k0 < n;  k0 += cholesky_block_size)
+    {
+        size_t const    c0 = min(n, k0 + cholesky_block_size);
+
+        //- Update and factor the diagonal block of the panel.
+        //
+        for (size_t j = k0;  j < c0;  ++j)
+        {
+            for (size_t jj = k0;  jj < j;  ++jj)
+            {
+                T const     s = strided_dot(jj, &elem(j, 0), cs, &elem(jj, 0), cs);
+
+                elem(j, jj) = (elem(j, jj) - s) / elem(jj, jj);
+            }
+
+            T const     d = elem(j, j) - strided_dot(j, &elem(j, 0), cs, &elem(j, 0), cs);
+
+            if (!(d > T()))
+            {
+                throw runtime_error("matrix is not positive definite");
+            }
+            elem(j, j) = sqrt(d);
+        }
+
+        //- Update the rows below the diagonal block and solve them against it.
+        //
+        parallel_for(c0, n, (n - c0) * (c0 - k0) * c0, [=](size_t first, size_t last)
+        {
+            for (size_t i = first;  i < last;  ++i)
+            {
+                for (size_t j = k0;  j < c0;  ++j)
+                {
+                    T const     s = strided_dot(j, &elem(i, 0), cs, &elem(j, 0), cs);
+
+                    elem(i, j) = (elem(i, j) - s) / elem(j, j);
+                }
+            }
+        });
+    }
+}
+
+//- Overwrites the n x nrhs right-hand sides X, whose element (i, r) is at p_x[i*x_rs + r*x_cs],
+//  with the solution of L*L'*X = B, by forward substitution with L and back substitution with L'.
+//  Both passes read L by rows, and the right-hand sides are divided among the tasks.
+//
+template<class T, class R>
+void
+cholesky_solve_in_place(size_t n, T const* p_l, ptrdiff_t rs, ptrdiff_t cs,
+                        size_t nrhs, R* p_x, ptrdiff_t x_rs, ptrdiff_t x_cs)
+{
+    auto    l = [p_l, rs, cs](size_t i, size_t j) -> T
+    {
+        return p_l[(ptrdiff_t) i*rs + (ptrdiff_t) j*cs];
+    };
+    auto    x = [p_x, x_rs, x_cs](size_t i, size_t r) -> R&
+    {
+        return p_x[(ptrdiff_t) i*x_rs + (ptrdiff_t) r*x_cs];
+    };
+
+    parallel_for(0, nrhs, n * n * nrhs, [=](size_t first, size_t last)
+    {
+        for (size_t i = 0;  i < n;  ++i)
+        {
+            for (size_t k = 0;  k < i;  ++k)
+            {
+                T const     lik = l(i, k);
+
+                for (size_t r = first;  r < last;  ++r)
+                {
+                    x(i, r) -= lik * x(k, r);
+                }
+            }
+            for (size_t r = first;  r < last;  ++r)
+            {
+                x(i, r) /= l(i, i);
+            }
+        }
+
+        for (size_t i = n;  i-- > 0;)
+        {
+            for (size_t r = first;  r < last;  ++r)
+            {
+                x(i, r) /= l(i, i);
+            }
+            for (size_t k = 0;  k < i;  ++k)
+            {
+                T const     lik = l(i, k);
+
+                for (size_t r = first;  r < last;  ++r)
+                {
+                    x(k, r) -= lik * x(i, r);
+                }
+            }
+        }
+    });
+}
+
+}       //- detail namespace
+
+
+//==================================================================================================
+//  Cholesky factorization and solvers for real symmetric positive-definite matrices.  The matrix
+//  may be a dense owning matrix or a writable view of one (such as a submatrix or transpose), and
+//  is factored in place: its lower triangle is overwritten with L such that A = L*L', its strict
+//  upper triangle is left untouched, and no workspace is allocated.  An exception is thrown if the
+//  matrix is found not to be positive definite, in which case it is left partially factored.
+//
+//  The solvers take the factored matrix.  cholesky_solve_in_place() overwrites a writable dense
+//  vector or matrix of right-hand sides with the solution, while cholesky_solve() returns the
+//  solution in a new dynamic vector or matrix.  Multiple right-hand sides are divided among
+//  threads.  The factorization takes time proportional to n^3/3, half that of LU.
+//==================================================================================================
+//
+template<class ET1, class OT1>
+void
+cholesky_in_place(matrix<ET1, OT1>& a)
+{
+    static_assert(detail::has_strided_layout_v<ET1>);
+    static_assert(!detail::is_complex_v<typename ET1::value_type>);
+
+    if (a.rows() != a.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    auto&       eng      = a.engine();
+    auto const  [rs, cs] = eng.stride();
+
+    detail::blocked_cholesky_in_place(static_cast<size_t>(a.rows()), eng.data(), rs, cs);
+}
+
+template<class ET1, class OT1, class ET2, class OT2>
+void
+cholesky_solve_in_place(matrix<ET1, OT1> const& l, vector<ET2, OT2>& b)
+{
+    static_assert(detail::has_strided_layout_v<ET1>  &&  detail::has_strided_layout_v<ET2>);
+
+    if (l.rows() != l.columns()  ||  static_cast<size_t>(b.size()) != static_cast<size_t>(l.rows()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    auto const  [rs, cs] = l.engine().stride();
+
+    detail::cholesky_solve_in_place(static_cast<size_t>(l.rows()), l.engine().data(), rs, cs,
+                                    1u, b.engine().data(), b.engine().stride(), ptrdiff_t(0));
+}
+
+template<class ET1, class OT1, class ET2, class OT2>
+void
+cholesky_solve_in_place(matrix<ET1, OT1> const& l, matrix<ET2, OT2>& b)
+{
+    static_assert(detail::has_strided_layout_v<ET1>  &&  detail::has_strided_layout_v<ET2>);
+
+    if (l.rows() != l.columns()  ||  static_cast<size_t>(b.rows()) != static_cast<size_t>(l.rows()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    auto const  [rs, cs]     = l.engine().stride();
+    auto const  [b_rs, b_cs] = b.engine().stride();
+
+    detail::cholesky_solve_in_place(static_cast<size_t>(l.rows()), l.engine().data(), rs, cs,
+                                    static_cast<size_t>(b.columns()), b.engine().data(),
+                                    b_rs, b_cs);
+}
+
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+cholesky_solve(matrix<ET1, OT1> const& l, vector<ET2, OT2> const& b)
+{
+    using element_type = common_type_t<typename ET1::value_type, typename ET2::value_type>;
+
+    static_assert(detail::has_strided_layout_v<ET1>);
+
+    if (l.rows() != l.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_t const    n = static_cast<size_t>(l.rows());
+    auto            x = detail::rhs_to_array<element_type>(b, n);
+    auto const      [rs, cs] = l.engine().stride();
+
+    detail::cholesky_solve_in_place(n, l.engine().data(), rs, cs,
+                                    1u, x.data(), ptrdiff_t(1), ptrdiff_t(0));
+    return detail::array_to_solution(b, x);
+}
+
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+cholesky_solve(matrix<ET1, OT1> const& l, matrix<ET2, OT2> const& b)
+{
+    using element_type = common_type_t<typename ET1::value_type, typename ET2::value_type>;
+
+    static_assert(detail::has_strided_layout_v<ET1>);
+
+    if (l.rows() != l.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_t const    n    = static_cast<size_t>(l.rows());
+    size_t const    nrhs = detail::rhs_count(b);
+    auto            x    = detail::rhs_to_array<element_type>(b, n);
+    auto const      [rs, cs] = l.engine().stride();
+
+    detail::cholesky_solve_in_place(n, l.engine().data(), rs, cs,
+                                    nrhs, x.data(), (ptrdiff_t) nrhs, ptrdiff_t(1));
+    return detail::array_to_solution(b, x);
+}
+
+
+namespace detail {
+//==================================================================================================
+//  Some private helpers for Householder QR factorization of the m x n matrix (m >= n) whose
+//  element (i, j) is at p_a[i*rs + j*cs].  The reflector H(j) = I - tau(j)*v*v' that annihilates
+//  the elements below the diagonal of column j has v(j) = 1, and its other elements are stored
+//  below the diagonal in place of the elements they annihilate.
+//==================================================================================================
+//
+inline constexpr size_t     qr_block_size = 32;
+
+//- Generates the reflector for column j, overwriting the diagonal element with the corresponding
+//  element of R and the elements below it with v, and returns tau.  The norm of the column is
+//  computed with scaling, so that it neither overflows nor underflows.
+//
+template<class T>
+T
+make_reflector(size_t m, size_t j, T* p_a, ptrdiff_t rs, ptrdiff_t cs)
+{
+    T* const        p_x = p_a + (ptrdiff_t) j*rs + (ptrdiff_t) j*cs;
+    size_t const    len = m - j;
+    T               scale{};
+    T               ssq{};
+
+    for (size_t k = 1;  k < len;  ++k)
+    {
+        scale = max<T>(scale, abs(p_x[(ptrdiff_t) k*rs]));
+    }
+
+    if (scale == T()) return T();
+
+    for (size_t k = 1;  k < len;  ++k)
+    {
+        T const     t = p_x[(ptrdiff_t) k*rs] / scale;
+        ssq += t * t;
+    }
+
+    T const     alpha = p_x[0];
+    T const     beta  = -copysign(hypot(alpha, scale * sqrt(ssq)), alpha);
+    T const     inv   = T(1) / (alpha - beta);
+
+    for (size_t k = 1;  k < len;  ++k)
+    {
+        p_x[(ptrdiff_t) k*rs] *= inv;
+    }
+    p_x[0] = beta;
+
+    return (beta - alpha) / beta;
+}
+
+//- Applies the reflector of column j from the left to the columns [c_first, c_last).  The row
+//  vector w = tau*v'*A is summed in per-task partial sums over rows, and the update A -= v*w is
+//  then divided among the tasks by rows.
+//
+template<class T>
+void
+apply_reflector(size_t m, size_t j, T tau, T* p_a, ptrdiff_t rs, ptrdiff_t cs,
+                size_t c_first, size_t c_last)
+{
+    size_t const    width = c_last - c_first;
+
+    if (tau == T()  ||  width == 0) return;
+
+    size_t const    rows  = m - j;
+    size_t const    tasks = task_count(rows, rows * width);
+    std::vector<T>  part(tasks * width);
+
+    auto    v = [=](size_t i) -> T
+    {
+        return (i == j) ? T(1) : p_a[(ptrdiff_t) i*rs + (ptrdiff_t) j*cs];
+    };
+
+    parallel_tasks(tasks, [&](size_t t)
+    {
+        T* const    p_w = part.data() + t*width;
+
+        for (size_t i = j + (rows*t)/tasks;  i < j + (rows*(t + 1))/tasks;  ++i)
+        {
+            T const             vi   = v(i);
+            T const* const      p_ai = p_a + (ptrdiff_t) i*rs + (ptrdiff_t) c_first*cs;
+
+            for (size_t c = 0;  c < width;  ++c)
+            {
+                p_w[c] += vi * p_ai[(ptrdiff_t) c*cs];
+            }
+        }
+    });
+
+    for (size_t c = 0;  c < width;  ++c)
+    {
+        for (size_t t = 1;  t < tasks;  ++t)
+        {
+            part[c] += part[t*width + c];
+        }
+        part[c] *= tau;
+    }
+
+    parallel_tasks(tasks, [&](size_t t)
+    {
+        T const* const  p_w = part.data();
+
+        for (size_t i = j + (rows*t)/tasks;  i < j + (rows*(t + 1))/tasks;  ++i)
+        {
+            T const     vi   = v(i);
+            T* const    p_ai = p_a + (ptrdiff_t) i*rs + (ptrdiff_t) c_first*cs;
+
+            for (size_t c = 0;  c < width;  ++c)
+            {
+                p_ai[(ptrdiff_t) c*cs] -= vi * p_w[c];
+            }
+        }
+    });
+}
+
+//- Blocked Householder QR factorization.  Each panel of qr_block_size columns is factored one
+//  reflector at a time.  The reflectors of the panel are then combined in the compact WY form
+//  H(k0)*...*H(c0-1) = I - V*T*V', where V holds the vectors v explicitly and T is upper
+//  triangular, so that the remaining columns are updated by two GEMMs, A2 -= V*(T'*(V'*A2)).
+//  Workspace proportional to m times the panel width is allocated.
+//
+template<class T>
+void
+blocked_qr_in_place(size_t m, size_t n, T* p_a, ptrdiff_t rs, ptrdiff_t cs, T* p_tau)
+{
+    std::vector<T>  vbuf, gram, tmat, wbuf;
+
+    auto    elem = [p_a, rs, cs](size_t i, size_t j) -> T&
+    {
+        return p_a[(ptrdiff_t) i*rs + (ptrdiff_t) j*cs];
+    };
+
+    for (size_t k0 = 0;  k0 < n;  k0 += qr_block_size)
+    {
+        size_t const    kb = min(qr_block_size, n - k0);
+        size_t const    c0 = k0 + kb;
+
+        //- Factor the panel of columns [k0, c0).
+        //
+        for (size_t j = k0;  j < c0;  ++j)
+        {
+            p_tau[j] = make_reflector(m, j, p_a, rs, cs);
+            apply_reflector(m, j, p_tau[j], p_a, rs, cs, j + 1, c0);
+        }
+
+        if (c0 == n) break;
+
+        //- Form V explicitly, with its unit diagonal and the zeros above it, and find T from
+        //  the Gram matrix V'*V.
+        //
+        size_t const    mv = m - k0;
+        size_t const    nw = n - c0;
+
+        vbuf.assign(mv * kb, T());
+        for (size_t r = 0;  r < mv;  ++r)
+        {
+            for (size_t p = 0;  p < kb  &&  p <= r;  ++p)
+            {
+                vbuf[r*kb + p] = (p == r) ? T(1) : elem(k0 + r, k0 + p);
+            }
+        }
+
+        gram.assign(kb * kb, T());
+        strided_gemm(kb, kb, mv, vbuf.data(), ptrdiff_t(1), (ptrdiff_t) kb,
+                     vbuf.data(), (ptrdiff_t) kb, ptrdiff_t(1), gram.data(), (ptrdiff_t) kb);
+
+        tmat.assign(kb * kb, T());
+        for (size_t i = 0;  i < kb;  ++i)
+        {
+            T const     tau = p_tau[k0 + i];
+
+            for (size_t p = 0;  p < i;  ++p)
+            {
+                T   sum{};
+
+                for (size_t q = p;  q < i;  ++q)
+                {
+                    sum += tmat[p*kb + q] * gram[q*kb + i];
+                }
+                tmat[p*kb + i] = -tau * sum;
+            }
+            tmat[i*kb + i] = tau;
+        }
+
+        //- Update the remaining columns: W = V'*A2, then W = T'*W, then A2 -= V*W.
+        //
+        wbuf.resize(kb * nw);
+        strided_gemm(kb, nw, mv, vbuf.data(), ptrdiff_t(1), (ptrdiff_t) kb,
+                     &elem(k0, c0), rs, cs, wbuf.data(), (ptrdiff_t) nw);
+
+        for (size_t i = kb;  i-- > 0;)
+        {
+            T* const    p_wi = wbuf.data() + i*nw;
+
+            for (size_t c = 0;  c < nw;  ++c)
+            {
+                p_wi[c] *= tmat[i*kb + i];
+            }
+            for (size_t p = 0;  p < i;  ++p)
+            {
+                T const             tpi  = tmat[p*kb + i];
+                T const* const      p_wp = wbuf.data() + p*nw;
+
+                for (size_t c = 0;  c < nw;  ++c)
+                {
+                    p_wi[c] += tpi * p_wp[c];
+                }
+            }
+        }
+
+        if (cs == 1)
+        {
+            strided_gemm_subtract(mv, nw, kb, vbuf.data(), (ptrdiff_t) kb, ptrdiff_t(1),
+                                  wbuf.data(), (ptrdiff_t) nw, &elem(k0, c0), rs);
+        }
+        else
+        {
+            parallel_for(0, mv, mv * nw * kb, [&](size_t first, size_t last)
+            {
+                for (size_t r = first;  r < last;  ++r)
+                {
+                    for (size_t p = 0;  p < kb  &&  p <= r;  ++p)
+                    {
+                        T const             v_rp = vbuf[r*kb + p];
+                        T const* const      p_wp = wbuf.data() + p*nw;
+
+                        for (size_t c = 0;  c < nw;  ++c)
+                        {
+                            elem(k0 + r, c0 + c) -= v_rp * p_wp[c];
+                        }
+                    }
+                }
+            });
+        }
+    }
+}
+
+//- Overwrites the m x nrhs row-major array x of right-hand sides with the n x nrhs least-squares
+//  solution, by applying Q' to the right-hand sides one reflector at a time and then solving
+//  with R by back substitution.  The right-hand sides are divided among the tasks.
+//
+template<class T, class R>
+void
+qr_solve_in_place(size_t m, size_t n, T const* p_a, ptrdiff_t rs, ptrdiff_t cs, T const* p_tau,
+                  std::vector<R>& x, size_t nrhs)
+{
+    auto    elem = [p_a, rs, cs](size_t i, size_t j) -> T
+    {
+        return p_a[(ptrdiff_t) i*rs + (ptrdiff_t) j*cs];
+    };
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        if (elem(i, i) == T())
+        {
+            throw runtime_error("singular matrix");
+        }
+    }
+
+    parallel_for(0, nrhs, m * n * nrhs, [&](size_t first, size_t last)
+    {
+        std::vector<R>  w(last - first);
+        R* const        p_x = x.data();
+
+        for (size_t j = 0;  j < n;  ++j)
+        {
+            if (p_tau[j] == T()) continue;
+
+            for (size_t r = first;  r < last;  ++r)
+            {
+                w[r - first] = p_x[j*nrhs + r];
+            }
+            for (size_t i = j + 1;  i < m;  ++i)
+            {
+                T const     vi = elem(i, j);
+
+                for (size_t r = first;  r < last;  ++r)
+                {
+                    w[r - first] += vi * p_x[i*nrhs + r];
+                }
+            }
+            for (size_t r = first;  r < last;  ++r)
+            {
+                w[r - first] *= p_tau[j];
+                p_x[j*nrhs + r] -= w[r - first];
+            }
+            for (size_t i = j + 1;  i < m;  ++i)
+            {
+                T const     vi = elem(i, j);
+
+                for (size_t r = first;  r < last;  ++r)
+                {
+                    p_x[i*nrhs + r] -= vi * w[r - first];
+                }
+            }
+        }
+
+        for (size_t i = n;  i-- > 0;)
+        {
+            for (size_t k = i + 1;  k < n;  ++k)
+            {
+                T const     rik = elem(i, k);
+
+                for (size_t r = first;  r < last;  ++r)
+                {
+                    p_x[i*nrhs + r] -= rik * p_x[k*nrhs + r];
+                }
+            }
+            for (size_t r = first;  r < last;  ++r)
+            {
+                p_x[i*nrhs + r] /= elem(i, i);
+            }
+        }
+    });
+
+    x.resize(n * nrhs);
+}
+
+//- Returns the least-squares solution for the right-hand side(s) b, given the factored matrix.
+//
+template<class T, class ET2, class OT2>
+auto
+qr_least_squares(size_t m, size_t n, T const* p_a, ptrdiff_t rs, ptrdiff_t cs, T const* p_tau,
+                 vector<ET2, OT2> const& b)
+{
+    using element_type_r = common_type_t<T, typename ET2::value_type>;
+
+    auto    x = rhs_to_array<element_type_r>(b, m);
+    qr_solve_in_place(m, n, p_a, rs, cs, p_tau, x, 1u);
+    return array_to_solution(b, x);
+}
+
+template<class T, class ET2, class OT2>
+auto
+qr_least_squares(size_t m, size_t n, T const* p_a, ptrdiff_t rs, ptrdiff_t cs, T const* p_tau,
+                 matrix<ET2, OT2> const& b)
+{
+    using element_type_r = common_type_t<T, typename ET2::value_type>;
+    using size_type_r    = typename dyn_matrix<element_type_r>::size_type;
+
+    size_t const    nrhs = rhs_count(b);
+    auto            x    = rhs_to_array<element_type_r>(b, m);
+
+    qr_solve_in_place(m, n, p_a, rs, cs, p_tau, x, nrhs);
+
+    dyn_matrix<element_type_r>  mr(static_cast<size_type_r>(n), static_cast<size_type_r>(nrhs));
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        for (size_t r = 0;  r < nrhs;  ++r)
+        {
+            mr(static_cast<size_type_r>(i), static_cast<size_type_r>(r)) = x[i*nrhs + r];
+        }
+    }
+    return mr;
+}
+
+}       //- detail namespace
+
+
+//==================================================================================================
+//  Householder QR factorization of an m x n matrix with m >= n, A = Q*R, where Q is orthogonal and
+//  R is upper triangular.  The factors are held packed in a single matrix: R in its upper
+//  triangle, and the Householder vectors whose product is Q below the diagonal, along with a
+//  vector of their scale factors tau.  The factorization is blocked, and uses the compact WY form
+//  of each block of reflectors so that most of its work is done by GEMMs divided among threads.
+//
+//  solve() returns the least-squares solution x minimizing |A*x - b|, for one or more right-hand
+//  sides, and throws an exception if R is singular (i.e., if A does not have full column rank).
+//  Constructing from an rvalue dynamic matrix factors it in place, without allocating a copy.
+//==================================================================================================
+//
+template<class T, class AT>
+class qr_factorization
+{
+  public:
+    //- Types
+    //
+    using element_type = T;
+    using matrix_type  = matrix<dr_matrix_engine<T, AT>>;
+    using size_type    = typename matrix_type::size_type;
+    using tau_type     = std::vector<T>;
+
+    //- Construct/copy/destroy
+    //
+    ~qr_factorization() noexcept = default;
+
+    qr_factorization() = default;
+    qr_factorization(qr_factorization&&) noexcept = default;
+    qr_factorization(qr_factorization const&) = default;
+    template<class ET2, class OT2>
+    explicit qr_factorization(matrix<ET2, OT2> const& a);
+    explicit qr_factorization(matrix_type&& a);
+
+    qr_factorization&   operator =(qr_factorization&&) noexcept = default;
+    qr_factorization&   operator =(qr_factorization const&) = default;
+
+    //- Factors
+    //
+    size_type           columns() const noexcept;
+    size_type           rows() const noexcept;
+    matrix_type const&  packed() const noexcept;
+    tau_type const&     tau() const noexcept;
+    matrix_type         r() const;
+
+    //- Results
+    //
+    template<class ET2, class OT2>
+    auto    solve(vector<ET2, OT2> const& b) const;
+    template<class ET2, class OT2>
+    auto    solve(matrix<ET2, OT2> const& b) const;
+
+  private:
+    matrix_type     m_qr;
+    tau_type        m_tau;
+
+    void    factor();
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class AT>
+template<class ET2, class OT2>
+qr_factorization<T,AT>::qr_factorization(matrix<ET2, OT2> const& a)
+:   m_qr(a)
+,   m_tau()
+{
+    factor();
+}
+
+template<class T, class AT>
+qr_factorization<T,AT>::qr_factorization(matrix_type&& a)
+:   m_qr(std::move(a))
+,   m_tau()
+{
+    factor();
+}
+
+//---------
+//- Factors
+//
+template<class T, class AT> inline
+typename qr_factorization<T,AT>::size_type
+qr_factorization<T,AT>::columns() const noexcept
+{
+    return m_qr.columns();
+}
+
+template<class T, class AT> inline
+typename qr_factorization<T,AT>::size_type
+qr_factorization<T,AT>::rows() const noexcept
+{
+    return m_qr.rows();
+}
+
+template<class T, class AT> inline
+typename qr_factorization<T,AT>::matrix_type const&
+qr_factorization<T,AT>::packed() const noexcept
+{
+    return m_qr;
+}
+
+template<class T, class AT> inline
+typename qr_factorization<T,AT>::tau_type const&
+qr_factorization<T,AT>::tau() const noexcept
+{
+    return m_tau;
+}
+
+template<class T, class AT>
+typename qr_factorization<T,AT>::matrix_type
+qr_factorization<T,AT>::r() const
+{
+    matrix_type     mr(columns(), columns());
+
+    for (size_type i = 0;  i < columns();  ++i)
+    {
+        for (size_type j = i;  j < columns();  ++j)
+        {
+            mr(i, j) = m_qr(i, j);
+        }
+    }
+    return mr;
+}
+
+//---------
+//- Results
+//
+template<class T, class AT>
+template<class ET2, class OT2>
+auto
+qr_factorization<T,AT>::solve(vector<ET2, OT2> const& b) const
+{
+    auto const  [rs, cs] = m_qr.engine().stride();
+
+    return detail::qr_least_squares(static_cast<size_t>(rows()), static_cast<size_t>(columns()),
+                                    m_qr.engine().data(), rs, cs, m_tau.data(), b);
+}
+
+template<class T, class AT>
+template<class ET2, class OT2>
+auto
+qr_factorization<T,AT>::solve(matrix<ET2, OT2> const& b) const
+{
+    auto const  [rs, cs] = m_qr.engine().stride();
+
+    return detail::qr_least_squares(static_cast<size_t>(rows()), static_cast<size_t>(columns()),
+                                    m_qr.engine().data(), rs, cs, m_tau.data(), b);
+}
+
+//------------------------
+//- Private implementation
+//
+template<class T, class AT>
+void
+qr_factorization<T,AT>::factor()
+{
+    if (m_qr.rows() < m_qr.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    m_tau.assign(static_cast<size_t>(m_qr.columns()), T());
+
+    if (m_qr.columns() != 0)
+    {
+        auto&       eng      = m_qr.engine();
+        auto const  [rs, cs] = eng.stride();
+
+        detail::blocked_qr_in_place(static_cast<size_t>(m_qr.rows()),
+                                    static_cast<size_t>(m_qr.columns()),
+                                    eng.data(), rs, cs, m_tau.data());
+    }
+}
+
+
+//==================================================================================================
+//  Free functions for QR factorization and least-squares problems.  qr_in_place() factors a dense
+//  owning matrix or a writable view of one (such as a submatrix) in place, leaving it holding the
+//  packed factors, and returns the scale factors tau; least_squares_in_place() does the same and
+//  returns the least-squares solution, so that a slice of a larger matrix can be solved without
+//  copying it.  least_squares() leaves its argument unchanged, and factors a copy.
+//==================================================================================================
+//
+template<class ET1, class OT1>
+auto
+qr_in_place(matrix<ET1, OT1>& a)
+{
+    using element_type = typename ET1::value_type;
+
+    static_assert(detail::has_strided_layout_v<ET1>);
+    static_assert(!detail::is_complex_v<element_type>);
+
+    if (a.rows() < a.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    std::vector<element_type>   tau(static_cast<size_t>(a.columns()));
+
+    if (!tau.empty())
+    {
+        auto&       eng      = a.engine();
+        auto const  [rs, cs] = eng.stride();
+
+        detail::blocked_qr_in_place(static_cast<size_t>(a.rows()), tau.size(),
+                                    eng.data(), rs, cs, tau.data());
+    }
+    return tau;
+}
+
+template<class ET1, class OT1>
+auto
+qr_factor(matrix<ET1, OT1> const& a)
+{
+    using element_type = detail::factor_element_t<typename ET1::value_type>;
+
+    return qr_factorization<element_type>(a);
+}
+
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+least_squares(matrix<ET1, OT1> const& a, vector<ET2, OT2> const& b)
+{
+    return qr_factor(a).solve(b);
+}
+
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+least_squares(matrix<ET1, OT1> const& a, matrix<ET2, OT2> const& b)
+{
+    return qr_factor(a).solve(b);
+}
+
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+least_squares_in_place(matrix<ET1, OT1>& a, vector<ET2, OT2> const& b)
+{
+    auto const  tau      = qr_in_place(a);
+    auto const  [rs, cs] = a.engine().stride();
+
+    return detail::qr_least_squares(static_cast<size_t>(a.rows()), tau.size(),
+                                    a.engine().data(), rs, cs, tau.data(), b);
+}
+
+template<class ET1, class OT1, class ET2, class OT2>
+auto
+least_squares_in_place(matrix<ET1, OT1>& a, matrix<ET2, OT2> const& b)
+{
+    auto const  tau      = qr_in_place(a);
+    auto const  [rs, cs] = a.engine().stride();
+
+    return detail::qr_least_squares(static_cast<size_t>(a.rows()), tau.size(),
+                                    a.engine().data(), rs, cs, tau.data(), b);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_FACTORIZATIONS_HPP_DEFINED
@@ -47,6 +47,8 @@ class fs_vector_engine
 
     constexpr fs_vector_engine&     operator =(fs_vector_engine&&) noexcept = default;
     constexpr fs_vector_engine&     operator =(fs_vector_engine const&) = default;
+    template<class ET2>
+    constexpr fs_vector_engine&     operator =(ET2 const& rhs);
 
 #ifdef LA_USE_VECTOR_ENGINE_ITERATORS
     //- Iterators
@@ -69,6 +71,13 @@ class fs_vector_engine
     constexpr reference         operator ()(size_type i);
     constexpr const_reference   operator ()(size_type i) const;
 
+    //- Layout
+    //
+    constexpr pointer                   data() noexcept;
+    constexpr const_pointer             data() const noexcept;
+    static constexpr difference_type    stride() noexcept;
+    static constexpr bool               is_contiguous() noexcept;
+
     //- Modifiers
     //
     constexpr void  swap(fs_vector_engine& rhs) noexcept;
@@ -83,6 +92,7 @@ class fs_vector_engine
 //
 template<class T, size_t N> constexpr
 fs_vector_engine<T,N>::fs_vector_engine()
+:   ma_elems()
 {
     if constexpr (is_arithmetic_v<T>)
     {
@@ -118,6 +128,29 @@ fs_vector_engine<T,N>::fs_vector_engine(initializer_list<U> list)
     }
 }
 
+template<class T, size_t N> 
+template<class ET2> constexpr 
+fs_vector_engine<T,N>&
+fs_vector_engine<T,N>::operator =(ET2 const& rhs)
+{
+    using src_size_type = typename ET2::size_type;
+
+    if ((size_type) rhs.elements() != N) 
+    {
+        throw runtime_error("invalid size");
+    }
+
+    src_size_type   si;
+    size_type       di;
+
+    for (di = 0, si = 0;  di < N;  ++di, ++si)
+    {
+        ma_elems[di] = static_cast<T>(rhs(si));
+    }
+
+    return *this;
+}
+
 #ifdef LA_USE_VECTOR_ENGINE_ITERATORS
 //-----------
 //- Iterators
@@ -199,6 +232,37 @@ fs_vector_engine<T,N>::operator ()(size_type i) const
     return ma_elems[i];
 }
 
+//--------
+//- Layout
+//
+template<class T, size_t N> constexpr 
+typename fs_vector_engine<T,N>::pointer
+fs_vector_engine<T,N>::data() noexcept
+{
+    return ma_elems;
+}
+
+template<class T, size_t N> constexpr 
+typename fs_vector_engine<T,N>::const_pointer
+fs_vector_engine<T,N>::data() const noexcept
+{
+    return ma_elems;
+}
+
+template<class T, size_t N> constexpr 
+typename fs_vector_engine<T,N>::difference_type
+fs_vector_engine<T,N>::stride() noexcept
+{
+    return 1;
+}
+
+template<class T, size_t N> constexpr 
+bool
+fs_vector_engine<T,N>::is_contiguous() noexcept
+{
+    return true;
+}
+
 //-----------
 //- Modifiers
 //
@@ -246,6 +310,7 @@ class fs_matrix_engine
     using difference_type = ptrdiff_t;
     using size_type       = size_t;
     using size_tuple      = tuple<size_type, size_type>;
+    using stride_tuple    = tuple<difference_type, difference_type>;
 
     //- Construct/copy/destroy
     //
@@ -277,6 +342,13 @@ class fs_matrix_engine
     constexpr reference         operator ()(size_type i, size_type j);
     constexpr const_reference   operator ()(size_type i, size_type j) const;
 
+    //- Layout
+    //
+    constexpr pointer           data() noexcept;
+    constexpr const_pointer     data() const noexcept;
+    constexpr stride_tuple      stride() const noexcept;
+    constexpr bool              is_contiguous() const noexcept;
+
     //- Modifiers
     //
     constexpr void      swap(fs_matrix_engine& rhs) noexcept;
@@ -341,14 +413,14 @@ fs_matrix_engine<T,R,C>::operator =(ET2 const& rhs)
         throw runtime_error("invalid size");
     }
 
-    src_size_type   si = 0, sj = 0;
-    size_type       di = 0, dj = 0;
+    src_size_type   si, sj;
+    size_type       di, dj;
 
-    for (;  di < rows();  ++di, ++si)
+    for (di = 0, si = 0;  di < R;  ++di, ++si)
     {
-        for (;  dj < columns();  ++dj, ++sj)
+        for (dj = 0, sj = 0;  dj < C;  ++dj, ++sj)
         {
-            (*this)(di, dj) = rhs(si, sj);
+            ma_elems[di*C + dj] = static_cast<T>(rhs(si, sj));
         }
     }
 
@@ -417,6 +489,37 @@ fs_matrix_engine<T,R,C>::operator ()(size_type i, size_type j) const
     return ma_elems[i*C + j];
 }
 
+//--------
+//- Layout
+//
+template<class T, size_t R, size_t C> constexpr 
+typename fs_matrix_engine<T,R,C>::pointer
+fs_matrix_engine<T,R,C>::data() noexcept
+{
+    return ma_elems;
+}
+
+template<class T, size_t R, size_t C> constexpr 
+typename fs_matrix_engine<T,R,C>::const_pointer
+fs_matrix_engine<T,R,C>::data() const noexcept
+{
+    return ma_elems;
+}
+
+template<class T, size_t R, size_t C> constexpr 
+typename fs_matrix_engine<T,R,C>::stride_tuple
+fs_matrix_engine<T,R,C>::stride() const noexcept
+{
+    return stride_tuple(static_cast<difference_type>(C), 1);
+}
+
+template<class T, size_t R, size_t C> constexpr 
+bool
+fs_matrix_engine<T,R,C>::is_contiguous() const noexcept
+{
+    return true;
+}
+
 //-----------
 //- Modifiers
 //
@@ -459,5 +562,534 @@ fs_matrix_engine<T,R,C>::swap_rows(size_type i1, size_type i2) noexcept
     }
 }
 
+
+//==================================================================================================
+//  Fixed-size, fixed-capacity vector engine whose storage is padded to a multiple of four lanes
+//  and aligned to A bytes, so that, e.g., a 3-vector of float occupies one 16-byte register.
+//  The padding elements are always zero, which lets the arithmetic kernels operate on whole
+//  lanes without masking.  They are not elements of the vector, and must not be changed through
+//  the pointer returned by data().
+//==================================================================================================
+//
+template<class T, size_t N, size_t A>
+class fs_padded_vector_engine
+{
+    static_assert(N >= 1);
+    static_assert(A >= alignof(T)  &&  (A & (A - 1)) == 0);
+
+  public:
+    using engine_category = writable_vector_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+
+#ifdef LA_USE_VECTOR_ENGINE_ITERATORS
+    using iterator        = detail::vector_iterator<fs_padded_vector_engine>;
+    using const_iterator  = detail::vector_const_iterator<fs_padded_vector_engine>;
+#endif
+
+    static constexpr size_t     padded_elements = detail::padded_extent(N);
+
+    //- Construct/copy/destroy
+    //
+    ~fs_padded_vector_engine() noexcept = default;
+
+    constexpr fs_padded_vector_engine();
+    constexpr fs_padded_vector_engine(fs_padded_vector_engine&&) noexcept = default;
+    constexpr fs_padded_vector_engine(fs_padded_vector_engine const&) = default;
+    template<class U>
+    constexpr fs_padded_vector_engine(initializer_list<U> list);
+
+    constexpr fs_padded_vector_engine&  operator =(fs_padded_vector_engine&&) noexcept = default;
+    constexpr fs_padded_vector_engine&  operator =(fs_padded_vector_engine const&) = default;
+    template<class ET2>
+    constexpr fs_padded_vector_engine&  operator =(ET2 const& rhs);
+
+#ifdef LA_USE_VECTOR_ENGINE_ITERATORS
+    //- Iterators
+    //
+    constexpr iterator          begin() noexcept;
+    constexpr iterator          end() noexcept;
+    constexpr const_iterator    begin() const noexcept;
+    constexpr const_iterator    end() const noexcept;
+    constexpr const_iterator    cbegin() const noexcept;
+    constexpr const_iterator    cend() const noexcept;
+#endif
+
+    //- Capacity
+    //
+    static constexpr size_type  capacity() noexcept;
+    static constexpr size_type  elements() noexcept;
+
+    //- Element access
+    //
+    constexpr reference         operator ()(size_type i);
+    constexpr const_reference   operator ()(size_type i) const;
+
+    //- Layout
+    //
+    constexpr pointer                   data() noexcept;
+    constexpr const_pointer             data() const noexcept;
+    static constexpr difference_type    stride() noexcept;
+    static constexpr bool               is_contiguous() noexcept;
+
+    //- Modifiers
+    //
+    constexpr void  swap(fs_padded_vector_engine& rhs) noexcept;
+    constexpr void  swap_elements(size_type i, size_type j) noexcept;
+
+  private:
+    alignas(A) T    ma_elems[padded_elements];
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, size_t N, size_t A> constexpr
+fs_padded_vector_engine<T,N,A>::fs_padded_vector_engine()
+:   ma_elems()
+{}
+
+template<class T, size_t N, size_t A>
+template<class U> constexpr
+fs_padded_vector_engine<T,N,A>::fs_padded_vector_engine(initializer_list<U> list)
+:   ma_elems()
+{
+    size_type   count = min<size_type>(N, list.size());
+    auto        iter  = list.begin();
+
+    for (size_type i = 0;  i < count;  ++i, ++iter)
+    {
+        ma_elems[i] = static_cast<T>(*iter);
+    }
+}
+
+template<class T, size_t N, size_t A>
+template<class ET2> constexpr
+fs_padded_vector_engine<T,N,A>&
+fs_padded_vector_engine<T,N,A>::operator =(ET2 const& rhs)
+{
+    using src_size_type = typename ET2::size_type;
+
+    if ((size_type) rhs.elements() != N)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    src_size_type   si = 0;
+    size_type       di = 0;
+
+    for (di = 0, si = 0;  di < N;  ++di, ++si)
+    {
+        ma_elems[di] = static_cast<T>(rhs(si));
+    }
+
+    return *this;
+}
+
+#ifdef LA_USE_VECTOR_ENGINE_ITERATORS
+//-----------
+//- Iterators
+//
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::iterator
+fs_padded_vector_engine<T,N,A>::begin() noexcept
+{
+    return iterator(this, 0, N);
+}
+
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::const_iterator
+fs_padded_vector_engine<T,N,A>::begin() const noexcept
+{
+    return const_iterator(this, 0, N);
+}
+
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::iterator
+fs_padded_vector_engine<T,N,A>::end() noexcept
+{
+    return iterator(this, N, N);
+}
+
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::const_iterator
+fs_padded_vector_engine<T,N,A>::end() const noexcept
+{
+    return const_iterator(this, N, N);
+}
+
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::const_iterator
+fs_padded_vector_engine<T,N,A>::cbegin() const noexcept
+{
+    return const_iterator(this, 0, N);
+}
+
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::const_iterator
+fs_padded_vector_engine<T,N,A>::cend() const noexcept
+{
+    return const_iterator(this, N, N);
+}
+
+#endif
+//----------
+//- Capacity
+//
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::size_type
+fs_padded_vector_engine<T,N,A>::capacity() noexcept
+{
+    return padded_elements;
+}
+
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::size_type
+fs_padded_vector_engine<T,N,A>::elements() noexcept
+{
+    return N;
+}
+
+//----------------
+//- Element access
+//
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::reference
+fs_padded_vector_engine<T,N,A>::operator ()(size_type i)
+{
+    return ma_elems[i];
+}
+
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::const_reference
+fs_padded_vector_engine<T,N,A>::operator ()(size_type i) const
+{
+    return ma_elems[i];
+}
+
+//--------
+//- Layout
+//
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::pointer
+fs_padded_vector_engine<T,N,A>::data() noexcept
+{
+    return ma_elems;
+}
+
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::const_pointer
+fs_padded_vector_engine<T,N,A>::data() const noexcept
+{
+    return ma_elems;
+}
+
+template<class T, size_t N, size_t A> constexpr
+typename fs_padded_vector_engine<T,N,A>::difference_type
+fs_padded_vector_engine<T,N,A>::stride() noexcept
+{
+    return 1;
+}
+
+template<class T, size_t N, size_t A> constexpr
+bool
+fs_padded_vector_engine<T,N,A>::is_contiguous() noexcept
+{
+    return true;
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, size_t N, size_t A> constexpr
+void
+fs_padded_vector_engine<T,N,A>::swap(fs_padded_vector_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        for (size_t i = 0;  i < N;  ++i)
+        {
+            detail::la_swap(ma_elems[i], rhs.ma_elems[i]);
+        }
+    }
+}
+
+template<class T, size_t N, size_t A> constexpr
+void
+fs_padded_vector_engine<T,N,A>::swap_elements(size_type i, size_type j) noexcept
+{
+    detail::la_swap(ma_elems[i], ma_elems[j]);
+}
+
+
+//==================================================================================================
+//  Fixed-size, fixed-capacity matrix engine whose rows are padded to a multiple of four lanes
+//  and aligned to A bytes, so that, e.g., a 3x3 matrix of float is stored as 3x4 and each of its
+//  rows occupies one 16-byte register.  As with fs_padded_vector_engine, the padding elements
+//  are always zero and must not be changed through the pointer returned by data().
+//==================================================================================================
+//
+template<class T, size_t R, size_t C, size_t A>
+class fs_padded_matrix_engine
+{
+    static_assert(R >= 1);
+    static_assert(C >= 1);
+    static_assert(A >= alignof(T)  &&  (A & (A - 1)) == 0);
+
+  public:
+    //- Types
+    //
+    using engine_category = writable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+    using stride_tuple    = tuple<difference_type, difference_type>;
+
+    static constexpr size_t     padded_columns = detail::padded_extent(C);
+
+    //- Construct/copy/destroy
+    //
+    ~fs_padded_matrix_engine() noexcept = default;
+
+    constexpr fs_padded_matrix_engine();
+    template<class U>
+    constexpr fs_padded_matrix_engine(initializer_list<U> list);
+    constexpr fs_padded_matrix_engine(fs_padded_matrix_engine&&) noexcept = default;
+    constexpr fs_padded_matrix_engine(fs_padded_matrix_engine const&) = default;
+
+    constexpr fs_padded_matrix_engine&  operator =(fs_padded_matrix_engine&&) noexcept = default;
+    constexpr fs_padded_matrix_engine&  operator =(fs_padded_matrix_engine const&) = default;
+    template<class ET2>
+    constexpr fs_padded_matrix_engine&  operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    constexpr size_type     columns() const noexcept;
+    constexpr size_type     rows() const noexcept;
+    constexpr size_tuple    size() const noexcept;
+
+    constexpr size_type     column_capacity() const noexcept;
+    constexpr size_type     row_capacity() const noexcept;
+    constexpr size_tuple    capacity() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference         operator ()(size_type i, size_type j);
+    constexpr const_reference   operator ()(size_type i, size_type j) const;
+
+    //- Layout
+    //
+    constexpr pointer           data() noexcept;
+    constexpr const_pointer     data() const noexcept;
+    constexpr stride_tuple      stride() const noexcept;
+    constexpr bool              is_contiguous() const noexcept;
+
+    //- Modifiers
+    //
+    constexpr void      swap(fs_padded_matrix_engine& rhs) noexcept;
+    constexpr void      swap_columns(size_type j1, size_type j2) noexcept;
+    constexpr void      swap_rows(size_type i1, size_type i2) noexcept;
+
+  private:
+    alignas(A) T    ma_elems[R*padded_columns];
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, size_t R, size_t C, size_t A> constexpr
+fs_padded_matrix_engine<T,R,C,A>::fs_padded_matrix_engine()
+:   ma_elems()
+{}
+
+//- The list holds the elements in row-major order, without padding.
+//
+template<class T, size_t R, size_t C, size_t A>
+template<class U> constexpr
+fs_padded_matrix_engine<T,R,C,A>::fs_padded_matrix_engine(initializer_list<U> list)
+:   ma_elems()
+{
+    size_t const    count = std::min(R*C, (size_t) list.size());
+    auto            iter  = list.begin();
+
+    for (size_t k = 0;  k < count;  ++k, ++iter)
+    {
+        ma_elems[(k / C)*padded_columns + (k % C)] = static_cast<T>(*iter);
+    }
+}
+
+template<class T, size_t R, size_t C, size_t A>
+template<class ET2> constexpr
+fs_padded_matrix_engine<T,R,C,A>&
+fs_padded_matrix_engine<T,R,C,A>::operator =(ET2 const& rhs)
+{
+    using src_size_type = typename ET2::size_type;
+
+    if (rhs.size() != size())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    src_size_type   si = 0, sj = 0;
+    size_type       di = 0, dj = 0;
+
+    for (di = 0, si = 0;  di < R;  ++di, ++si)
+    {
+        for (dj = 0, sj = 0;  dj < C;  ++dj, ++sj)
+        {
+            ma_elems[di*padded_columns + dj] = static_cast<T>(rhs(si, sj));
+        }
+    }
+
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, size_t R, size_t C, size_t A> constexpr
+typename fs_padded_matrix_engine<T,R,C,A>::size_type
+fs_padded_matrix_engine<T,R,C,A>::columns() const noexcept
+{
+    return C;
+}
+
+template<class T, size_t R, size_t C, size_t A> constexpr
+typename fs_padded_matrix_engine<T,R,C,A>::size_type
+fs_padded_matrix_engine<T,R,C,A>::rows() const noexcept
+{
+    return R;
+}
+
+template<class T, size_t R, size_t C, size_t A> constexpr
+typename fs_padded_matrix_engine<T,R,C,A>::size_tuple
+fs_padded_matrix_engine<T,R,C,A>::size() const noexcept
+{
+    return size_tuple(R, C);
+}
+
+template<class T, size_t R, size_t C, size_t A> constexpr
+typename fs_padded_matrix_engine<T,R,C,A>::size_type
+fs_padded_matrix_engine<T,R,C,A>::column_capacity() const noexcept
+{
+    return padded_columns;
+}
+
+template<class T, size_t R, size_t C, size_t A> constexpr
+typename fs_padded_matrix_engine<T,R,C,A>::size_type
+fs_padded_matrix_engine<T,R,C,A>::row_capacity() const noexcept
+{
+    return R;
+}
+
+template<class T, size_t R, size_t C, size_t A> constexpr
+typename fs_padded_matrix_engine<T,R,C,A>::size_tuple
+fs_padded_matrix_engine<T,R,C,A>::capacity() const noexcept
+{
+    return size_tuple(R, padded_columns);
+}
+
+//----------------
+//- Element access
+//
+template<class T, size_t R, size_t C, size_t A> constexpr
+typename fs_padded_matrix_engine<T,R,C,A>::reference
+fs_padded_matrix_engine<T,R,C,A>::operator ()(size_type i, size_type j)
+{
+    return ma_elems[i*padded_columns + j];
+}
+
+template<class T, size_t R, size_t C, size_t A> constexpr
+typename fs_padded_matrix_engine<T,R,C,A>::const_reference
+fs_padded_matrix_engine<T,R,C,A>::operator ()(size_type i, size_type j) const
+{
+    return ma_elems[i*padded_columns + j];
+}
+
+//--------
+//- Layout
+//
+template<class T, size_t R, size_t C, size_t A> constexpr
+typename fs_padded_matrix_engine<T,R,C,A>::pointer
+fs_padded_matrix_engine<T,R,C,A>::data() noexcept
+{
+    return ma_elems;
+}
+
+template<class T, size_t R, size_t C, size_t A> constexpr
+typename fs_padded_matrix_engine<T,R,C,A>::const_pointer
+fs_padded_matrix_engine<T,R,C,A>::data() const noexcept
+{
+    return ma_elems;
+}
+
+template<class T, size_t R, size_t C, size_t A> constexpr
+typename fs_padded_matrix_engine<T,R,C,A>::stride_tuple
+fs_padded_matrix_engine<T,R,C,A>::stride() const noexcept
+{
+    return stride_tuple(static_cast<difference_type>(padded_columns), 1);
+}
+
+template<class T, size_t R, size_t C, size_t A> constexpr
+bool
+fs_padded_matrix_engine<T,R,C,A>::is_contiguous() const noexcept
+{
+    return C == padded_columns  ||  R == 1;
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, size_t R, size_t C, size_t A> constexpr
+void
+fs_padded_matrix_engine<T,R,C,A>::swap(fs_padded_matrix_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        for (size_t i = 0;  i < R*padded_columns;  ++i)
+        {
+            detail::la_swap(ma_elems[i], rhs.ma_elems[i]);
+        }
+    }
+}
+
+template<class T, size_t R, size_t C, size_t A> constexpr
+void
+fs_padded_matrix_engine<T,R,C,A>::swap_columns(size_type j1, size_type j2) noexcept
+{
+    if (j1 != j2)
+    {
+        for (size_t i = 0;  i < R;  ++i)
+        {
+            detail::la_swap(ma_elems[i*padded_columns + j1], ma_elems[i*padded_columns + j2]);
+        }
+    }
+}
+
+template<class T, size_t R, size_t C, size_t A> constexpr
+void
+fs_padded_matrix_engine<T,R,C,A>::swap_rows(size_type i1, size_type i2) noexcept
+{
+    if (i1 != i2)
+    {
+        for (size_t j = 0;  j < C;  ++j)
+        {
+            detail::la_swap(ma_elems[i1*padded_columns + j], ma_elems[i2*padded_columns + j]);
+        }
+    }
+}
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_FIXED_SIZE_ENGINES_HPP_DEFINED
@@ -24,22 +24,87 @@ struct readable_matrix_engine_tag  : public integral_constant<int, 5> {};
 struct writable_matrix_engine_tag  : public integral_constant<int, 7> {};
 struct resizable_matrix_engine_tag : public integral_constant<int, 11> {};
 
+//- Tags that select the triangle, and the treatment of the diagonal, of triangular views.
+//
+struct upper_triangle_tag {};
+struct lower_triangle_tag {};
+
+struct unit_diagonal_tag {};
+struct nonunit_diagonal_tag {};
+
+//- Tags that select the order in which the tiles of tiled engines are stored.
+//
+struct row_major_tiles_tag {};
+struct z_order_tiles_tag {};
+
+//- Tag that selects the constructors by which dynamic engines take ownership of an existing buffer.
+//
+struct adopt_buffer_t { explicit adopt_buffer_t() = default; };
+
+inline constexpr adopt_buffer_t     adopt_buffer{};
+
+//- Reduced-precision, 16-bit floating-point element types.
+//
+class bfloat16;
+class half;
+
 //- Owning engines with dynamically-allocated external storage.
 //
 template<class T, class AT>     class dr_vector_engine;
 template<class T, class AT>     class dr_matrix_engine;
 
+//- Owning engines with shared, copy-on-write, dynamically-allocated external storage.
+//
+template<class T, class AT>     class cow_matrix_engine;
+
 //- Owning engines with fixed-size internal storage.
 //
 template<class T, size_t N>             class fs_vector_engine;
 template<class T, size_t R, size_t C>   class fs_matrix_engine;
 
+//- Owning engines with fixed-size, padded, and aligned internal storage.
+//
+template<class T, size_t N, size_t A = 4*sizeof(T)>              class fs_padded_vector_engine;
+template<class T, size_t R, size_t C, size_t A = 4*sizeof(T)>    class fs_padded_matrix_engine;
+
+//- Owning engines with structured, dynamically-allocated external storage.
+//
+template<class T, class AT>     class banded_matrix_engine;
+template<class T, class AT>     class symmetric_packed_engine;
+template<class T, class AT>     class diagonal_engine;
+template<class T, class AT>     class low_rank_engine;
+template<class T, class AT>     class toeplitz_engine;
+template<class T, class AT>     class circulant_engine;
+
+//- Owning engines with structured, constant-size internal storage.
+//
+template<class T>               class identity_engine;
+
+//- Owning engines with tiled, dynamically-allocated external storage.
+//
+template<class T, size_t B, class AT, class LT>     class tiled_matrix_engine;
+
+//- Owning engines with sparse, dynamically-allocated external storage.
+//
+template<class T, class IT, class AT>             class csr_matrix_engine;
+template<class T, size_t B, class IT, class AT>   class bsr_matrix_engine;
+
+//- Builders that assemble sparse engines from unordered (row, column, value) triplets.
+//
+template<class T, class IT = size_t, class AT = allocator<T>>  class coo_builder;
+
 //- Non-owning, view-style engines.
 //
 template<class ET, class VCT>   class column_engine;
 template<class ET, class VCT>   class row_engine;
 template<class ET, class MCT>   class transpose_engine;
 template<class ET, class MCT>   class submatrix_engine;
+template<class ET, class TT, class DT>  class triangular_engine;
+
+//- Non-owning engines that refer to external memory.
+//
+template<class T>   class span_vector_engine;
+template<class T>   class span_matrix_engine;
 
 template<class T>   struct scalar_engine;
 
@@ -48,10 +113,19 @@ template<class T>   struct scalar_engine;
 //
 struct matrix_operation_traits;
 
+//- Operation traits that compute products and sums of dense operands with CBLAS.
+//
+struct blas_matrix_operations;
+
 //- TODO: remove this
 //
 struct default_matrix_operations {};
 
+//- Factorizations of dense matrices.
+//
+template<class T, class AT = allocator<T>>  class lu_factorization;
+template<class T, class AT = allocator<T>>  class qr_factorization;
+
 //- Primary math object types.
 //
 template<class ET, class OT=matrix_operation_traits> class vector;
@@ -87,62 +161,62 @@ template<class T1, class T2>    struct matrix_operation_traits_selector;
 //- Addition operators
 //
 template<class ET1, class OT1, class ET2, class OT2>
-auto  operator +(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
+constexpr auto  operator +(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
 
 template<class ET1, class OT1, class ET2, class OT2>
-auto  operator +(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+constexpr auto  operator +(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
 
 //- Subtraction operators
 //
 template<class ET1, class OT1, class ET2, class OT2>
-auto  operator -(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
+constexpr auto  operator -(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
 
 template<class ET1, class OT1, class ET2, class OT2>
-auto  operator -(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+constexpr auto  operator -(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
 
 //- Negation operators
 //
 template<class ET1, class OT1>
-auto  operator -(vector<ET1, OT1> const& v1);
+constexpr auto  operator -(vector<ET1, OT1> const& v1);
 
 template<class ET1, class OT1, class ET2, class OT2>
-auto  operator -(matrix<ET1, OT1> const& m1);
+constexpr auto  operator -(matrix<ET1, OT1> const& m1);
 
 //- Vector*Scalar multiplication operators
 //
 template<class ET1, class OT1, class S2>
-auto  operator *(vector<ET1, OT1> const& v1, S2 const& s2);
+constexpr auto  operator *(vector<ET1, OT1> const& v1, S2 const& s2);
 
 template<class S1, class ET2, class OT2>
-auto    operator *(S1 const& s1, vector<ET2, OT2> const& v2);
+constexpr auto    operator *(S1 const& s1, vector<ET2, OT2> const& v2);
 
 //- Matrix*Scalar multiplication operators
 //
 template<class ET1, class OT1, class S2>
-auto  operator *(matrix<ET1, OT1> const& m1, S2 const& s2);
+constexpr auto  operator *(matrix<ET1, OT1> const& m1, S2 const& s2);
 
 template<class S1, class ET2, class OT2>
-auto  operator *(S1 const& s1, matrix<ET2, OT2> const& m2);
+constexpr auto  operator *(S1 const& s1, matrix<ET2, OT2> const& m2);
 
 //- Vector*Matrix multiplication operators
 //
 template<class ET1, class OT1, class ET2, class OT2>
-auto  operator *(vector<ET1, OT1> const& v1, matrix<ET2, OT2> const& m2);
+constexpr auto  operator *(vector<ET1, OT1> const& v1, matrix<ET2, OT2> const& m2);
 
 //- Matrix*Vector multiplication operators
 //
 template<class ET1, class OT1, class ET2, class OT2>
-auto  operator *(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2);
+constexpr auto  operator *(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2);
 
 //- Vector*Vector multiplication operators
 //
 template<class ET1, class OT1, class ET2, class OT2> 
-auto  operator *(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
+constexpr auto  operator *(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
 
 //- Matrix*Matrix multiplication operators
 //
 template<class ET1, class OT1, class ET2, class OT2>
-auto  operator *(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+constexpr auto  operator *(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
 
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_FORWARD_DECLARATIONS_HPP_DEFINED
@@ -20,6 +20,9 @@ using dyn_vector = vector<dr_vector_engine<T, A>>;
 template<class T, class A = allocator<T>>
 using dyn_matrix = matrix<dr_matrix_engine<T, A>>;
 
+template<class T, class A = allocator<T>>
+using cow_matrix = matrix<cow_matrix_engine<T, A>>;
+
 
 //- Aliases for column_vector/row_vector/matrix objects based on fixed-size engines.
 //
@@ -29,5 +32,59 @@ using fs_vector = vector<fs_vector_engine<T, N>>;
 template<class T, size_t R, size_t C>
 using fs_matrix = matrix<fs_matrix_engine<T, R, C>>;
 
+template<class T, size_t N, size_t A = 4*sizeof(T)>
+using fs_padded_vector = vector<fs_padded_vector_engine<T, N, A>>;
+
+template<class T, size_t R, size_t C, size_t A = 4*sizeof(T)>
+using fs_padded_matrix = matrix<fs_padded_matrix_engine<T, R, C, A>>;
+
+
+//- Aliases for matrix objects based on structured engines.
+//
+template<class T, class A = allocator<T>>
+using banded_matrix = matrix<banded_matrix_engine<T, A>>;
+
+template<class T, class A = allocator<T>>
+using symmetric_matrix = matrix<symmetric_packed_engine<T, A>>;
+
+template<class T, class A = allocator<T>>
+using diagonal_matrix = matrix<diagonal_engine<T, A>>;
+
+template<class T>
+using identity_matrix = matrix<identity_engine<T>>;
+
+template<class T, class A = allocator<T>>
+using low_rank_matrix = matrix<low_rank_engine<T, A>>;
+
+template<class T, class A = allocator<T>>
+using toeplitz_matrix = matrix<toeplitz_engine<T, A>>;
+
+template<class T, class A = allocator<T>>
+using circulant_matrix = matrix<circulant_engine<T, A>>;
+
+
+//- Aliases for matrix objects based on tiled engines.
+//
+template<class T, size_t B = 32, class A = allocator<T>, class LT = row_major_tiles_tag>
+using tiled_matrix = matrix<tiled_matrix_engine<T, B, A, LT>>;
+
+
+//- Aliases for vector/matrix objects that refer to external memory.
+//
+template<class T>
+using span_vector = vector<span_vector_engine<T>>;
+
+template<class T>
+using span_matrix = matrix<span_matrix_engine<T>>;
+
+
+//- Aliases for matrix objects based on sparse engines.
+//
+template<class T, class IT = size_t, class A = allocator<T>>
+using csr_matrix = matrix<csr_matrix_engine<T, IT, A>>;
+
+template<class T, size_t B, class IT = size_t, class A = allocator<T>>
+using bsr_matrix = matrix<bsr_matrix_engine<T, B, IT, A>>;
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_LIBRARY_ALIASES_HPP_DEFINED
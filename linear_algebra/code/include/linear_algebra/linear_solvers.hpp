@@ -0,0 +1,497 @@
+//==================================================================================================
+//  File:       linear_solvers.hpp
+//
+//  Summary:    This header defines free functions that solve systems of linear equations A*x = b
+//              (or A*X = B, for multiple right-hand sides), with implementations chosen according
+//              to the engine type of A.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_LINEAR_SOLVERS_HPP_DEFINED
+#define LINEAR_ALGEBRA_LINEAR_SOLVERS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Type in which a system whose elements are of type T is solved (or its matrix factored);
+//  integral elements are promoted to double, since the solution of an integer system is not in
+//  general integral.
+//==================================================================================================
+//
+template<class T>
+using factor_element_t = conditional_t<is_integral_v<T>, double, T>;
+
+//==================================================================================================
+//  The solvers work on a row-major n x nrhs array of right-hand sides, which is overwritten with
+//  the solution.  These helpers copy the right-hand side(s) into such an array, and copy the
+//  solution out of it into a new vector or matrix.
+//==================================================================================================
+//
+template<class R, class ET, class OT>
+std::vector<R>
+rhs_to_array(vector<ET, OT> const& b, size_t n)
+{
+    using size_type_b = typename vector<ET, OT>::size_type;
+
+    if (static_cast<size_t>(b.size()) != n)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    std::vector<R>  x(n);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        x[i] = static_cast<R>(b(static_cast<size_type_b>(i)));
+    }
+    return x;
+}
+
+template<class R, class ET, class OT>
+std::vector<R>
+rhs_to_array(matrix<ET, OT> const& b, size_t n)
+{
+    using size_type_b = typename matrix<ET, OT>::size_type;
+
+    if (static_cast<size_t>(b.rows()) != n)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_t const    nrhs = static_cast<size_t>(b.columns());
+    std::vector<R>  x(n * nrhs);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        for (size_t r = 0;  r < nrhs;  ++r)
+        {
+            x[i*nrhs + r] = static_cast<R>(b(static_cast<size_type_b>(i), static_cast<size_type_b>(r)));
+        }
+    }
+    return x;
+}
+
+template<class R, class ET, class OT>
+dyn_vector<R>
+array_to_solution(vector<ET, OT> const&, std::vector<R> const& x)
+{
+    using size_type_r = typename dyn_vector<R>::size_type;
+
+    dyn_vector<R>   vr(static_cast<size_type_r>(x.size()));
+
+    for (size_t i = 0;  i < x.size();  ++i)
+    {
+        vr(static_cast<size_type_r>(i)) = x[i];
+    }
+    return vr;
+}
+
+template<class R, class ET, class OT>
+dyn_matrix<R>
+array_to_solution(matrix<ET, OT> const& b, std::vector<R> const& x)
+{
+    using size_type_r = typename dyn_matrix<R>::size_type;
+
+    size_t const    nrhs = static_cast<size_t>(b.columns());
+    size_t const    n    = static_cast<size_t>(b.rows());
+    dyn_matrix<R>   mr(static_cast<size_type_r>(n), static_cast<size_type_r>(nrhs));
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        for (size_t r = 0;  r < nrhs;  ++r)
+        {
+            mr(static_cast<size_type_r>(i), static_cast<size_type_r>(r)) = x[i*nrhs + r];
+        }
+    }
+    return mr;
+}
+
+template<class ET, class OT>
+size_t
+rhs_count(vector<ET, OT> const&)
+{
+    return 1u;
+}
+
+template<class ET, class OT>
+size_t
+rhs_count(matrix<ET, OT> const& b)
+{
+    return static_cast<size_t>(b.columns());
+}
+
+//==================================================================================================
+//  Solvers for banded systems.
+//==================================================================================================
+//
+//- Returns true if each row of the tridiagonal matrix is diagonally dominant, in which case the
+//  Thomas algorithm (elimination without pivoting) is stable.
+//
+template<class T, class AT>
+bool
+tridiagonal_is_dominant(banded_matrix_engine<T, AT> const& a)
+{
+    size_t const    n = a.rows();
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        auto    off = (i > 0)     ? abs(a.band_element(i, i - 1)) : decltype(abs(T())){};
+        auto    up  = (i + 1 < n) ? abs(a.band_element(i, i + 1)) : decltype(abs(T())){};
+
+        if (abs(a.band_element(i, i)) < off + up) return false;
+    }
+    return true;
+}
+
+//- Thomas algorithm for tridiagonal systems; requires O(n) scratch space.
+//
+template<class T, class AT, class R>
+void
+solve_tridiagonal(banded_matrix_engine<T, AT> const& a, R* p_x, size_t nrhs)
+{
+    size_t const        n = a.rows();
+    std::vector<R>      c(n);
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        R   m = static_cast<R>(a.band_element(i, i));
+
+        if (i > 0)
+        {
+            R const     l = static_cast<R>(a.band_element(i, i - 1));
+
+            m -= l * c[i - 1];
+            for (size_t r = 0;  r < nrhs;  ++r)
+            {
+                p_x[i*nrhs + r] -= l * p_x[(i - 1)*nrhs + r];
+            }
+        }
+
+        if (m == R())
+        {
+            throw runtime_error("singular matrix");
+        }
+
+        c[i] = (i + 1 < n) ? static_cast<R>(a.band_element(i, i + 1)) / m : R();
+        for (size_t r = 0;  r < nrhs;  ++r)
+        {
+            p_x[i*nrhs + r] /= m;
+        }
+    }
+
+    for (size_t i = n - 1;  i-- > 0;)
+    {
+        for (size_t r = 0;  r < nrhs;  ++r)
+        {
+            p_x[i*nrhs + r] -= c[i] * p_x[(i + 1)*nrhs + r];
+        }
+    }
+}
+
+//- Banded LU factorization with partial pivoting, applied to the right-hand sides as it proceeds.
+//  Row interchanges widen the upper bandwidth of U to kl + ku, so the working copy of the band
+//  holds 2*kl + ku + 1 slots per row; element (i, j) is in slot (j - i + kl) of row i.
+//
+template<class T, class AT, class R>
+void
+solve_banded(banded_matrix_engine<T, AT> const& a, R* p_x, size_t nrhs)
+{
+    size_t const    n  = a.rows();
+    size_t const    kl = a.lower_bandwidth();
+    size_t const    ku = a.upper_bandwidth();
+    size_t const    w  = 2*kl + ku + 1;
+    std::vector<R>  lu(n * w);
+
+    auto    elem = [&lu, w, kl](size_t i, size_t j) -> R& { return lu[i*w + (j + kl - i)]; };
+
+    for (size_t i = 0;  i < n;  ++i)
+    {
+        size_t const    j_first = (i > kl) ? i - kl : 0;
+        size_t const    j_last  = min(n, i + ku + 1);
+
+        for (size_t j = j_first;  j < j_last;  ++j)
+        {
+            elem(i, j) = static_cast<R>(a.band_element(i, j));
+        }
+    }
+
+    for (size_t k = 0;  k < n;  ++k)
+    {
+        size_t const    i_last = min(n, k + kl + 1);
+        size_t const    j_last = min(n, k + kl + ku + 1);
+        size_t          p      = k;
+
+        for (size_t i = k + 1;  i < i_last;  ++i)
+        {
+            if (abs(elem(i, k)) > abs(elem(p, k))) p = i;
+        }
+
+        if (elem(p, k) == R())
+        {
+            throw runtime_error("singular matrix");
+        }
+
+        if (p != k)
+        {
+            for (size_t j = k;  j < j_last;  ++j)
+            {
+                detail::la_swap(elem(k, j), elem(p, j));
+            }
+            for (size_t r = 0;  r < nrhs;  ++r)
+            {
+                detail::la_swap(p_x[k*nrhs + r], p_x[p*nrhs + r]);
+            }
+        }
+
+        R const     pivot = elem(k, k);
+
+        for (size_t i = k + 1;  i < i_last;  ++i)
+        {
+            R const     l = elem(i, k) / pivot;
+
+            if (l == R()) continue;
+
+            for (size_t j = k + 1;  j < j_last;  ++j)
+            {
+                elem(i, j) -= l * elem(k, j);
+            }
+            for (size_t r = 0;  r < nrhs;  ++r)
+            {
+                p_x[i*nrhs + r] -= l * p_x[k*nrhs + r];
+            }
+        }
+    }
+
+    for (size_t i = n;  i-- > 0;)
+    {
+        size_t const    j_last = min(n, i + kl + ku + 1);
+
+        for (size_t j = i + 1;  j < j_last;  ++j)
+        {
+            for (size_t r = 0;  r < nrhs;  ++r)
+            {
+                p_x[i*nrhs + r] -= elem(i, j) * p_x[j*nrhs + r];
+            }
+        }
+        for (size_t r = 0;  r < nrhs;  ++r)
+        {
+            p_x[i*nrhs + r] /= elem(i, i);
+        }
+    }
+}
+
+template<class T, class AT, class R>
+void
+solve_banded_in_place(banded_matrix_engine<T, AT> const& a, R* p_x, size_t nrhs)
+{
+    if (a.rows() != a.columns())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    if (a.rows() == 0) return;
+
+    if (a.lower_bandwidth() == 0  &&  a.upper_bandwidth() == 0)
+    {
+        for (size_t i = 0;  i < a.rows();  ++i)
+        {
+            R const     d = static_cast<R>(a.band_element(i, i));
+
+            if (d == R())
+            {
+                throw runtime_error("singular matrix");
+            }
+            for (size_t r = 0;  r < nrhs;  ++r)
+            {
+                p_x[i*nrhs + r] /= d;
+            }
+        }
+    }
+    else if (a.lower_bandwidth() == 1  &&  a.upper_bandwidth() == 1  &&  tridiagonal_is_dominant(a))
+    {
+        solve_tridiagonal(a, p_x, nrhs);
+    }
+    else
+    {
+        solve_banded(a, p_x, nrhs);
+    }
+}
+
+//==================================================================================================
+//  Blocked solver for triangular systems.  The triangle is processed in diagonal blocks of
+//  tri_block_size rows: each diagonal block is solved by substitution, with the right-hand sides
+//  divided among the tasks, and its columns are then eliminated from all of the rows that remain,
+//  with those rows divided among the tasks.
+//==================================================================================================
+//
+inline constexpr size_t     tri_block_size = 64;
+
+template<class ET, class TT, class DT, class R>
+void
+solve_triangular_in_place(triangular_engine<ET, TT, DT> const& a, R* p_x, size_t nrhs)
+{
+    using engine_type   = triangular_engine<ET, TT, DT>;
+    using ref_size_type = typename ET::size_type;
+
+    ET const&       e = a.referent();
+    size_t const    n = static_cast<size_t>(a.rows());
+
+    if (static_cast<size_t>(a.columns()) != n)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    auto    elem = [&e](size_t i, size_t j) -> R
+    {
+        return static_cast<R>(e(static_cast<ref_size_type>(i), static_cast<ref_size_type>(j)));
+    };
+
+    if constexpr (!engine_type::is_unit)
+    {
+        for (size_t i = 0;  i < n;  ++i)
+        {
+            if (elem(i, i) == R())
+            {
+                throw runtime_error("singular matrix");
+            }
+        }
+    }
+
+    //- Solves rows [ib, ie) for right-hand sides [r_first, r_last), in the direction of elimination.
+    //
+    auto    solve_block = [&](size_t ib, size_t ie, size_t r_first, size_t r_last)
+    {
+        for (size_t t = ib;  t < ie;  ++t)
+        {
+            size_t const    i       = engine_type::is_upper ? ib + ie - 1 - t : t;
+            size_t const    j_first = engine_type::is_upper ? i + 1 : ib;
+            size_t const    j_last  = engine_type::is_upper ? ie : i;
+
+            for (size_t j = j_first;  j < j_last;  ++j)
+            {
+                R const     aij = elem(i, j);
+
+                for (size_t r = r_first;  r < r_last;  ++r)
+                {
+                    p_x[i*nrhs + r] -= aij * p_x[j*nrhs + r];
+                }
+            }
+
+            if constexpr (!engine_type::is_unit)
+            {
+                R const     aii = elem(i, i);
+
+                for (size_t r = r_first;  r < r_last;  ++r)
+                {
+                    p_x[i*nrhs + r] /= aii;
+                }
+            }
+        }
+    };
+
+    //- Eliminates the solved rows [ib, ie) from the rows [first, last).
+    //
+    auto    update_rows = [&](size_t ib, size_t ie, size_t first, size_t last)
+    {
+        for (size_t i = first;  i < last;  ++i)
+        {
+            for (size_t j = ib;  j < ie;  ++j)
+            {
+                R const     aij = elem(i, j);
+
+                if (aij == R()) continue;
+
+                for (size_t r = 0;  r < nrhs;  ++r)
+                {
+                    p_x[i*nrhs + r] -= aij * p_x[j*nrhs + r];
+                }
+            }
+        }
+    };
+
+    for (size_t done = 0;  done < n;  done += tri_block_size)
+    {
+        size_t const    bs = min(tri_block_size, n - done);
+        size_t const    ib = engine_type::is_upper ? n - done - bs : done;
+        size_t const    ie = ib + bs;
+
+        detail::parallel_for(0, nrhs, bs * bs * nrhs / 2, [&](size_t r_first, size_t r_last)
+        {
+            solve_block(ib, ie, r_first, r_last);
+        });
+
+        size_t const    rest_first = engine_type::is_upper ? 0  : ie;
+        size_t const    rest_last  = engine_type::is_upper ? ib : n;
+
+        detail::parallel_for(rest_first, rest_last, (rest_last - rest_first) * bs * nrhs,
+                             [&](size_t first, size_t last)
+        {
+            update_rows(ib, ie, first, last);
+        });
+    }
+}
+
+}       //- detail namespace
+
+
+//==================================================================================================
+//  Solvers for banded matrices.  Tridiagonal systems that are diagonally dominant are solved by
+//  the Thomas algorithm; all others by banded LU factorization with partial pivoting.  Both take
+//  time proportional to n times the square of the bandwidth, and an exception is thrown if the
+//  matrix is found to be singular.  Integral systems are solved in double.
+//==================================================================================================
+//
+template<class T1, class A1, class OT1, class ET2, class OT2>
+auto
+solve(matrix<banded_matrix_engine<T1, A1>, OT1> const& a, vector<ET2, OT2> const& b)
+{
+    using element_type = detail::factor_element_t<common_type_t<T1, typename ET2::element_type>>;
+
+    auto    x = detail::rhs_to_array<element_type>(b, a.rows());
+    detail::solve_banded_in_place(a.engine(), x.data(), detail::rhs_count(b));
+    return detail::array_to_solution(b, x);
+}
+
+template<class T1, class A1, class OT1, class ET2, class OT2>
+auto
+solve(matrix<banded_matrix_engine<T1, A1>, OT1> const& a, matrix<ET2, OT2> const& b)
+{
+    using element_type = detail::factor_element_t<common_type_t<T1, typename ET2::element_type>>;
+
+    auto    x = detail::rhs_to_array<element_type>(b, a.rows());
+    detail::solve_banded_in_place(a.engine(), x.data(), detail::rhs_count(b));
+    return detail::array_to_solution(b, x);
+}
+
+
+//==================================================================================================
+//  Solvers for triangular views (TRSV and TRSM).  Only the selected triangle of the referent is
+//  read, and an exception is thrown if a diagonal element of a non-unit triangle is zero.
+//  Integral systems are solved in double.
+//==================================================================================================
+//
+template<class ET1, class TT1, class DT1, class OT1, class ET2, class OT2>
+auto
+solve(matrix<triangular_engine<ET1, TT1, DT1>, OT1> const& a, vector<ET2, OT2> const& b)
+{
+    using element_type = detail::factor_element_t<common_type_t<typename ET1::element_type,
+                                                                 typename ET2::element_type>>;
+
+    auto    x = detail::rhs_to_array<element_type>(b, a.rows());
+    detail::solve_triangular_in_place(a.engine(), x.data(), detail::rhs_count(b));
+    return detail::array_to_solution(b, x);
+}
+
+template<class ET1, class TT1, class DT1, class OT1, class ET2, class OT2>
+auto
+solve(matrix<triangular_engine<ET1, TT1, DT1>, OT1> const& a, matrix<ET2, OT2> const& b)
+{
+    using element_type = detail::factor_element_t<common_type_t<typename ET1::element_type,
+                                                                 typename ET2::element_type>>;
+
+    auto    x = detail::rhs_to_array<element_type>(b, a.rows());
+    detail::solve_triangular_in_place(a.engine(), x.data(), detail::rhs_count(b));
+    return detail::array_to_solution(b, x);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_LINEAR_SOLVERS_HPP_DEFINED
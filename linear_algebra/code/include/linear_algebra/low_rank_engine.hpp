@@ -0,0 +1,335 @@
+//==================================================================================================
+//  File:       low_rank_engine.hpp
+//
+//  Summary:    This header defines an owning matrix engine for matrices held in factored,
+//              low-rank form.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_LOW_RANK_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_LOW_RANK_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//  Low-rank matrix engine.  An m x n matrix of rank at most k is represented by the factors U
+//  (m x k) and V (n x k), such that the matrix is U * V.t(); element (i, j) is the dot product of
+//  row i of U and row j of V.  Both factors are stored by rows, so that U(i, p) is at offset
+//  i*k + p of the left factor and V(j, p) is at offset j*k + p of the right factor.
+//
+//  The elements of the product cannot be written, so the engine is readable; the elements of the
+//  factors are written through the left_factor() and right_factor() member functions.
+//==================================================================================================
+//
+template<class T, class AT>
+class low_rank_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using element_array   = std::vector<element_type, allocator_type>;
+
+    //- Construct/copy/destroy
+    //
+    ~low_rank_engine() noexcept = default;
+
+    low_rank_engine();
+    low_rank_engine(low_rank_engine&& rhs) noexcept;
+    low_rank_engine(low_rank_engine const& rhs) = default;
+    low_rank_engine(size_type rows, size_type cols, size_type rank);
+    template<class ET1, class ET2>
+    low_rank_engine(ET1 const& u, ET2 const& v);
+
+    low_rank_engine&    operator =(low_rank_engine&& rhs) noexcept;
+    low_rank_engine&    operator =(low_rank_engine const& rhs) = default;
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    size_type   rank() const noexcept;
+
+    //- Element access
+    //
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    element_type&       left_factor(size_type i, size_type p);
+    element_type const& left_factor(size_type i, size_type p) const;
+    element_type&       right_factor(size_type j, size_type p);
+    element_type const& right_factor(size_type j, size_type p) const;
+
+    //- Factor storage access
+    //
+    const_pointer       left_factor_data() const noexcept;
+    pointer             left_factor_data() noexcept;
+    const_pointer       right_factor_data() const noexcept;
+    pointer             right_factor_data() noexcept;
+
+    //- Modifiers
+    //
+    void    swap(low_rank_engine& rhs) noexcept;
+
+  private:
+    size_type       m_rows;
+    size_type       m_cols;
+    size_type       m_rank;
+    element_array   m_left;         //- Holds m_rows * m_rank elements of U
+    element_array   m_right;        //- Holds m_cols * m_rank elements of V
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class AT>
+low_rank_engine<T,AT>::low_rank_engine()
+:   m_rows(0)
+,   m_cols(0)
+,   m_rank(0)
+,   m_left()
+,   m_right()
+{}
+
+template<class T, class AT>
+low_rank_engine<T,AT>::low_rank_engine(low_rank_engine&& rhs) noexcept
+:   low_rank_engine()
+{
+    rhs.swap(*this);
+}
+
+template<class T, class AT>
+low_rank_engine<T,AT>::low_rank_engine(size_type rows, size_type cols, size_type rank)
+:   m_rows(rows)
+,   m_cols(cols)
+,   m_rank(rank)
+,   m_left(rows * rank, value_type())
+,   m_right(cols * rank, value_type())
+{}
+
+template<class T, class AT>
+template<class ET1, class ET2>
+low_rank_engine<T,AT>::low_rank_engine(ET1 const& u, ET2 const& v)
+:   low_rank_engine()
+{
+    static_assert(is_matrix_engine_v<ET1>  &&  is_matrix_engine_v<ET2>);
+    using size_type_1 = typename ET1::size_type;
+    using size_type_2 = typename ET2::size_type;
+
+    if (static_cast<size_type>(u.columns()) != static_cast<size_type>(v.columns()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    low_rank_engine     tmp(static_cast<size_type>(u.rows()),
+                            static_cast<size_type>(v.rows()),
+                            static_cast<size_type>(u.columns()));
+
+    for (size_type i = 0;  i < tmp.m_rows;  ++i)
+    {
+        for (size_type p = 0;  p < tmp.m_rank;  ++p)
+        {
+            tmp.left_factor(i, p) = static_cast<value_type>(u(static_cast<size_type_1>(i),
+                                                              static_cast<size_type_1>(p)));
+        }
+    }
+    for (size_type j = 0;  j < tmp.m_cols;  ++j)
+    {
+        for (size_type p = 0;  p < tmp.m_rank;  ++p)
+        {
+            tmp.right_factor(j, p) = static_cast<value_type>(v(static_cast<size_type_2>(j),
+                                                               static_cast<size_type_2>(p)));
+        }
+    }
+
+    tmp.swap(*this);
+}
+
+template<class T, class AT>
+low_rank_engine<T,AT>&
+low_rank_engine<T,AT>::operator =(low_rank_engine&& rhs) noexcept
+{
+    low_rank_engine     tmp;
+    tmp.swap(rhs);
+    tmp.swap(*this);
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_type
+low_rank_engine<T,AT>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_type
+low_rank_engine<T,AT>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_tuple
+low_rank_engine<T,AT>::size() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_type
+low_rank_engine<T,AT>::column_capacity() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_type
+low_rank_engine<T,AT>::row_capacity() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_tuple
+low_rank_engine<T,AT>::capacity() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::size_type
+low_rank_engine<T,AT>::rank() const noexcept
+{
+    return m_rank;
+}
+
+//----------------
+//- Element access
+//
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::const_reference
+low_rank_engine<T,AT>::operator ()(size_type i, size_type j) const
+{
+    const_pointer   p_u = m_left.data() + i*m_rank;
+    const_pointer   p_v = m_right.data() + j*m_rank;
+    value_type      elem{};
+
+    for (size_type p = 0;  p < m_rank;  ++p)
+    {
+        elem += p_u[p] * p_v[p];
+    }
+    return elem;
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::element_type&
+low_rank_engine<T,AT>::left_factor(size_type i, size_type p)
+{
+    return m_left[i*m_rank + p];
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::element_type const&
+low_rank_engine<T,AT>::left_factor(size_type i, size_type p) const
+{
+    return m_left[i*m_rank + p];
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::element_type&
+low_rank_engine<T,AT>::right_factor(size_type j, size_type p)
+{
+    return m_right[j*m_rank + p];
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::element_type const&
+low_rank_engine<T,AT>::right_factor(size_type j, size_type p) const
+{
+    return m_right[j*m_rank + p];
+}
+
+//-----------------------
+//- Factor storage access
+//
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::const_pointer
+low_rank_engine<T,AT>::left_factor_data() const noexcept
+{
+    return m_left.data();
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::pointer
+low_rank_engine<T,AT>::left_factor_data() noexcept
+{
+    return m_left.data();
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::const_pointer
+low_rank_engine<T,AT>::right_factor_data() const noexcept
+{
+    return m_right.data();
+}
+
+template<class T, class AT> inline
+typename low_rank_engine<T,AT>::pointer
+low_rank_engine<T,AT>::right_factor_data() noexcept
+{
+    return m_right.data();
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class AT>
+void
+low_rank_engine<T,AT>::swap(low_rank_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        detail::la_swap(m_rows, rhs.m_rows);
+        detail::la_swap(m_cols, rhs.m_cols);
+        detail::la_swap(m_rank, rhs.m_rank);
+        m_left.swap(rhs.m_left);
+        m_right.swap(rhs.m_right);
+    }
+}
+
+
+//==================================================================================================
+//  Returns a matrix whose engine holds the factors u and v of the product u * v.t(); for example,
+//  low_rank(u, v).  The factors are copied, and must have the same number of columns.
+//==================================================================================================
+//
+template<class ET1, class OT1, class ET2, class OT2>
+inline auto
+low_rank(matrix<ET1, OT1> const& u, matrix<ET2, OT2> const& v)
+{
+    using elem_type   = common_type_t<typename ET1::value_type, typename ET2::value_type>;
+    using engine_type = low_rank_engine<elem_type, allocator<elem_type>>;
+
+    return matrix<engine_type, OT1>(engine_type(u.engine(), v.engine()));
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_LOW_RANK_ENGINE_HPP_DEFINED
@@ -61,6 +61,8 @@ class matrix
     constexpr matrix(initializer_list<U> list);
     template<class ET2, class OT2>
     constexpr matrix(matrix<ET2, OT2> const& src);
+    constexpr explicit matrix(engine_type const& eng);
+    constexpr explicit matrix(engine_type&& eng);
     template<class ET2 = ET, detail::enable_if_resizable<ET, ET2> = true>
     constexpr matrix(size_tuple size);
     template<class ET2 = ET, detail::enable_if_resizable<ET, ET2> = true>
@@ -100,6 +102,8 @@ class matrix
     constexpr void      resize(size_tuple size, size_tuple cap);
     template<class ET2 = ET, detail::enable_if_resizable<ET, ET2> = true>
     constexpr void      resize(size_type rows, size_type cols, size_type rowcap, size_type colcap);
+    template<class ET2 = ET, detail::enable_if_resizable<ET, ET2> = true>
+    constexpr void      shrink_to_fit();
 
     //- Element access
     //
@@ -132,6 +136,9 @@ class matrix
     template<class ET2 = ET, detail::enable_if_writable<ET, ET2> = true>
     constexpr void      swap_rows(size_type i, size_type j) noexcept;
 
+    template<class ET2, class OT2, class ET3 = ET, detail::enable_if_resizable<ET, ET3> = true>
+    constexpr void      append_row(vector<ET2, OT2> const& row);
+
   private:
     template<class ET2, class OT2> friend class matrix;
     template<class ET2, class OT2> friend class vector;
@@ -156,9 +163,19 @@ template<class ET2, class OT2> constexpr
 matrix<ET,OT>::matrix(matrix<ET2, OT2> const& rhs)
 :   m_engine()
 {
-    assign(rhs);
+    m_engine = rhs.m_engine;
 }
 
+template<class ET, class OT> constexpr
+matrix<ET,OT>::matrix(engine_type const& eng)
+:   m_engine(eng)
+{}
+
+template<class ET, class OT> constexpr
+matrix<ET,OT>::matrix(engine_type&& eng)
+:   m_engine(std::move(eng))
+{}
+
 template<class ET, class OT>
 template<class ET2, detail::enable_if_resizable<ET, ET2>> constexpr 
 matrix<ET,OT>::matrix(size_tuple size)
@@ -291,6 +308,14 @@ matrix<ET,OT>::resize(size_type rows, size_type cols, size_type rowcap, size_typ
     m_engine.resize(rows, cols, rowcap, colcap);
 }
 
+template<class ET, class OT>
+template<class ET2, detail::enable_if_resizable<ET, ET2>> constexpr
+void
+matrix<ET,OT>::shrink_to_fit()
+{
+    m_engine.shrink_to_fit();
+}
+
 //----------------
 //- Element access
 //
@@ -437,6 +462,14 @@ matrix<ET,OT>::swap_rows(size_type r1, size_type r2) noexcept
     m_engine.swap_rows(r1, r2);
 }
 
+template<class ET, class OT>
+template<class ET2, class OT2, class ET3, detail::enable_if_resizable<ET, ET3>> constexpr
+void
+matrix<ET,OT>::append_row(vector<ET2, OT2> const& row)
+{
+    m_engine.append_row(row.engine());
+}
+
 //------------
 //- Comparison
 //
@@ -444,13 +477,19 @@ template<class ET1, class OT1, class ET2, class OT2>
 constexpr bool
 operator ==(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2)
 {
+    using size_type_1 = typename matrix<ET1, OT1>::size_type;
+    using size_type_2 = typename matrix<ET2, OT2>::size_type;
+
     if (m1.size() != m2.size()) return false;
 
-    for (int i = 0;  i < m1.rows();  ++i)
+    size_type_1     i1, j1;
+    size_type_2     i2, j2;
+
+    for (i1 = 0, i2 = 0;  i1 < m1.rows();  ++i1, ++i2)
     {
-        for (int j = 0;  j < m2.columns();  ++j)
+        for (j1 = 0, j2 = 0;  j1 < m1.columns();  ++j1, ++j2)
         {
-            if (m1(i, j) != m2(i, j)) return false;
+            if (m1(i1, j1) != m2(i2, j2)) return false;
         }
     }
     return true;
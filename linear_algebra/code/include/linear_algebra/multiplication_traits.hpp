@@ -836,6 +836,227 @@ struct matrix_multiplication_engine_traits<OT,
 };
 
 
+//--------------------------------------------------------------------------------------------------
+//- ENGINE * ENGINE cases for sparse matrix/matrix.  The product of two sparse matrices is sparse.
+//
+//- csr_matrix_engine * csr_matrix_engine.
+//
+template<class OT, class T1, class IT1, class A1, class T2, class IT2, class A2>
+struct matrix_multiplication_engine_traits<OT,
+                                           csr_matrix_engine<T1, IT1, A1>,
+                                           csr_matrix_engine<T2, IT2, A2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using index_type   = common_type_t<IT1, IT2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = csr_matrix_engine<element_type, index_type, alloc_type>;
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//- ENGINE * ENGINE cases for banded matrix/matrix.  The product of two banded matrices is banded,
+//  with bandwidths equal to the sums of the operands' bandwidths.
+//
+//- banded_matrix_engine * banded_matrix_engine.
+//
+template<class OT, class T1, class A1, class T2, class A2>
+struct matrix_multiplication_engine_traits<OT,
+                                           banded_matrix_engine<T1, A1>,
+                                           banded_matrix_engine<T2, A2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = banded_matrix_engine<element_type, alloc_type>;
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//- ENGINE * ENGINE cases for diagonal and identity matrix/matrix.  The product of two diagonal
+//  matrices is diagonal, and the product of two identity matrices is an identity matrix.
+//
+//- diagonal_engine * diagonal_engine.
+//
+template<class OT, class T1, class A1, class T2, class A2>
+struct matrix_multiplication_engine_traits<OT, diagonal_engine<T1, A1>, diagonal_engine<T2, A2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = diagonal_engine<element_type, alloc_type>;
+};
+
+//- identity_engine * identity_engine.
+//
+template<class OT, class T1, class T2>
+struct matrix_multiplication_engine_traits<OT, identity_engine<T1>, identity_engine<T2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = identity_engine<element_type>;
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//- ENGINE * ENGINE cases for low-rank matrix/matrix.  The product of two low-rank matrices is
+//  low-rank, with rank no greater than the smaller of the operands' ranks.
+//
+//- low_rank_engine * low_rank_engine.
+//
+template<class OT, class T1, class A1, class T2, class A2>
+struct matrix_multiplication_engine_traits<OT, low_rank_engine<T1, A1>, low_rank_engine<T2, A2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = low_rank_engine<element_type, alloc_type>;
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//- ENGINE * ENGINE cases for tiled matrix/matrix.  The product of two tiled matrices with the same
+//  tile size is tiled, with the tile order of the left-hand operand.
+//
+//- tiled_matrix_engine * tiled_matrix_engine.
+//
+template<class OT, class T1, size_t B, class A1, class LT1, class T2, class A2, class LT2>
+struct matrix_multiplication_engine_traits<OT,
+                                           tiled_matrix_engine<T1, B, A1, LT1>,
+                                           tiled_matrix_engine<T2, B, A2, LT2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using alloc_type   = detail::rebind_alloc_t<A1, element_type>;
+    using engine_type  = tiled_matrix_engine<element_type, B, alloc_type, LT1>;
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//- ENGINE * SCALAR, SCALAR * ENGINE, and ENGINE * ENGINE cases for padded fixed-size engines.  The
+//  result is padded, with the alignment of the padded operand, or of the left-hand operand when
+//  both are padded.
+//
+//- fs_padded_vector_engine * scalar.
+//
+template<class OT, class T1, size_t N1, size_t A1, class T2>
+struct matrix_multiplication_engine_traits<OT, fs_padded_vector_engine<T1, N1, A1>, scalar_engine<T2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_vector_engine<element_type, N1, A1>;
+};
+
+//- scalar * fs_padded_vector_engine.
+//
+template<class OT, class T1, class T2, size_t N2, size_t A2>
+struct matrix_multiplication_engine_traits<OT, scalar_engine<T1>, fs_padded_vector_engine<T2, N2, A2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_vector_engine<element_type, N2, A2>;
+};
+
+//- fs_padded_matrix_engine * scalar.
+//
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class T2>
+struct matrix_multiplication_engine_traits<OT,
+                                           fs_padded_matrix_engine<T1, R1, C1, A1>,
+                                           scalar_engine<T2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_matrix_engine<element_type, R1, C1, A1>;
+};
+
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class MCT1, class T2>
+struct matrix_multiplication_engine_traits<OT,
+                                           transpose_engine<fs_padded_matrix_engine<T1, R1, C1, A1>, MCT1>,
+                                           scalar_engine<T2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_matrix_engine<element_type, C1, R1, A1>;
+};
+
+//- scalar * fs_padded_matrix_engine.
+//
+template<class OT, class T1, class T2, size_t R2, size_t C2, size_t A2>
+struct matrix_multiplication_engine_traits<OT,
+                                           scalar_engine<T1>,
+                                           fs_padded_matrix_engine<T2, R2, C2, A2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_matrix_engine<element_type, R2, C2, A2>;
+};
+
+template<class OT, class T1, class T2, size_t R2, size_t C2, size_t A2, class MCT2>
+struct matrix_multiplication_engine_traits<OT,
+                                           scalar_engine<T1>,
+                                           transpose_engine<fs_padded_matrix_engine<T2, R2, C2, A2>, MCT2>>
+{
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_matrix_engine<element_type, C2, R2, A2>;
+};
+
+//- fs_padded_matrix_engine * fs_padded_vector_engine.
+//
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class T2, size_t N2, size_t A2>
+struct matrix_multiplication_engine_traits<OT,
+                                           fs_padded_matrix_engine<T1, R1, C1, A1>,
+                                           fs_padded_vector_engine<T2, N2, A2>>
+{
+    static_assert(C1 == N2);
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_vector_engine<element_type, R1, A1>;
+};
+
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class MCT1, class T2, size_t N2, size_t A2>
+struct matrix_multiplication_engine_traits<OT,
+                                           transpose_engine<fs_padded_matrix_engine<T1, R1, C1, A1>, MCT1>,
+                                           fs_padded_vector_engine<T2, N2, A2>>
+{
+    static_assert(R1 == N2);
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_vector_engine<element_type, C1, A1>;
+};
+
+//- fs_padded_matrix_engine * fs_padded_matrix_engine.
+//
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class T2, size_t R2, size_t C2, size_t A2>
+struct matrix_multiplication_engine_traits<OT,
+                                           fs_padded_matrix_engine<T1, R1, C1, A1>,
+                                           fs_padded_matrix_engine<T2, R2, C2, A2>>
+{
+    static_assert(C1 == R2);
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_matrix_engine<element_type, R1, C2, A1>;
+};
+
+template<class OT, class T1, size_t R1, size_t C1, size_t A1,
+         class T2, size_t R2, size_t C2, size_t A2, class MCT2>
+struct matrix_multiplication_engine_traits<OT,
+                                           fs_padded_matrix_engine<T1, R1, C1, A1>,
+                                           transpose_engine<fs_padded_matrix_engine<T2, R2, C2, A2>, MCT2>>
+{
+    static_assert(C1 == C2);
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_matrix_engine<element_type, R1, R2, A1>;
+};
+
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class MCT1,
+         class T2, size_t R2, size_t C2, size_t A2>
+struct matrix_multiplication_engine_traits<OT,
+                                           transpose_engine<fs_padded_matrix_engine<T1, R1, C1, A1>, MCT1>,
+                                           fs_padded_matrix_engine<T2, R2, C2, A2>>
+{
+    static_assert(R1 == R2);
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_matrix_engine<element_type, C1, C2, A1>;
+};
+
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class MCT1,
+         class T2, size_t R2, size_t C2, size_t A2, class MCT2>
+struct matrix_multiplication_engine_traits<OT,
+                                           transpose_engine<fs_padded_matrix_engine<T1, R1, C1, A1>, MCT1>,
+                                           transpose_engine<fs_padded_matrix_engine<T2, R2, C2, A2>, MCT2>>
+{
+    static_assert(R1 == C2);
+    using element_type = matrix_multiplication_element_t<OT, T1, T2>;
+    using engine_type  = fs_padded_matrix_engine<element_type, C1, R2, A1>;
+};
+
+
 //==================================================================================================
 //                                **** MULTIPLICATION TRAITS ****
 //==================================================================================================
@@ -863,7 +1084,7 @@ struct matrix_multiplication_traits<OT, vector<ET1, OT1>, T2>
     using size_type_1 = typename vector<ET1, OT1>::size_type;
     using size_type_r = typename result_type::size_type;
 
-    static result_type  multiply(vector<ET1, OT1> const& v1, T2 const& s2);
+    static constexpr result_type  multiply(vector<ET1, OT1> const& v1, T2 const& s2);
 };
 
 //---------------
@@ -880,7 +1101,7 @@ struct matrix_multiplication_traits<OT, T1, vector<ET2, OT2>>
     using size_type_2 = typename vector<ET2, OT2>::size_type;
     using size_type_r = typename result_type::size_type;
 
-    static result_type  multiply(T1 const& s1, vector<ET2, OT2> const& v2);
+    static constexpr result_type  multiply(T1 const& s1, vector<ET2, OT2> const& v2);
 };
 
 //---------------
@@ -897,7 +1118,7 @@ struct matrix_multiplication_traits<OT, matrix<ET1, OT1>, T2>
     using size_type_1 = typename matrix<ET1, OT1>::size_type;
     using size_type_r = typename result_type::size_type;
 
-    static result_type  multiply(matrix<ET1, OT1> const& m1, T2 const& s2);
+    static constexpr result_type  multiply(matrix<ET1, OT1> const& m1, T2 const& s2);
 };
 
 //---------------
@@ -914,7 +1135,7 @@ struct matrix_multiplication_traits<OT, T1, matrix<ET2, OT2>>
     using size_type_2 = typename matrix<ET2, OT2>::size_type;
     using size_type_r = typename result_type::size_type;
 
-    static result_type  multiply(T1 const& s1, matrix<ET2, OT2> const& m2);
+    static constexpr result_type  multiply(T1 const& s1, matrix<ET2, OT2> const& m2);
 };
 
 //---------------
@@ -934,7 +1155,7 @@ struct matrix_multiplication_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>
     using size_type_1 = typename vector<ET1, OT1>::size_type;
     using size_type_2 = typename vector<ET2, OT2>::size_type;
 
-    static result_type  multiply(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
+    static constexpr result_type  multiply(vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2);
 };
 
 //---------------
@@ -951,7 +1172,7 @@ struct matrix_multiplication_traits<OT, matrix<ET1, OT1>, vector<ET2, OT2>>
     using size_type_2 = typename vector<ET2, OT2>::size_type;
     using size_type_r = typename result_type::size_type;
 
-    static result_type  multiply(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& m2);
+    static constexpr result_type  multiply(matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& m2);
 };
 
 //---------------
@@ -968,7 +1189,7 @@ struct matrix_multiplication_traits<OT, vector<ET1, OT1>, matrix<ET2, OT2>>
     using size_type_2 = typename matrix<ET2, OT2>::size_type;
     using size_type_r = typename result_type::size_type;
 
-    static result_type  multiply(vector<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+    static constexpr result_type  multiply(vector<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
 };
 
 //---------------
@@ -985,7 +1206,500 @@ struct matrix_multiplication_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>
     using size_type_2 = typename matrix<ET2, OT2>::size_type;
     using size_type_r = typename result_type::size_type;
 
-    static result_type  multiply(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+    static constexpr result_type  multiply(matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+//-------------------
+//- csr_matrix*vector
+//
+template<class OT, class T1, class IT1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<csr_matrix_engine<T1, IT1, A1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type_1 = csr_matrix_engine<T1, IT1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+//-------------------
+//- csr_matrix*matrix
+//
+template<class OT, class T1, class IT1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<csr_matrix_engine<T1, IT1, A1>, OT1>, matrix<ET2, OT2>>
+{
+    using engine_type_1 = csr_matrix_engine<T1, IT1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+//-----------------------
+//- csr_matrix*csr_matrix
+//
+template<class OT, class T1, class IT1, class A1, class OT1, class T2, class IT2, class A2, class OT2>
+struct matrix_multiplication_traits<OT,
+                                    matrix<csr_matrix_engine<T1, IT1, A1>, OT1>,
+                                    matrix<csr_matrix_engine<T2, IT2, A2>, OT2>>
+{
+    using engine_type_1 = csr_matrix_engine<T1, IT1, A1>;
+    using engine_type_2 = csr_matrix_engine<T2, IT2, A2>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, engine_type_2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<engine_type_2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1,
+                                 matrix<engine_type_2, OT2> const& m2);
+};
+
+//-------------------
+//- bsr_matrix*vector
+//
+template<class OT, class T1, size_t B1, class IT1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<bsr_matrix_engine<T1, B1, IT1, A1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type_1 = bsr_matrix_engine<T1, B1, IT1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+//-------------------
+//- bsr_matrix*matrix
+//
+template<class OT, class T1, size_t B1, class IT1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<bsr_matrix_engine<T1, B1, IT1, A1>, OT1>, matrix<ET2, OT2>>
+{
+    using engine_type_1 = bsr_matrix_engine<T1, B1, IT1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+//----------------------
+//- banded_matrix*vector
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<banded_matrix_engine<T1, A1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type_1 = banded_matrix_engine<T1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+//----------------------
+//- banded_matrix*matrix
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<banded_matrix_engine<T1, A1>, OT1>, matrix<ET2, OT2>>
+{
+    using engine_type_1 = banded_matrix_engine<T1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+//-----------------------------
+//- banded_matrix*banded_matrix
+//
+template<class OT, class T1, class A1, class OT1, class T2, class A2, class OT2>
+struct matrix_multiplication_traits<OT,
+                                    matrix<banded_matrix_engine<T1, A1>, OT1>,
+                                    matrix<banded_matrix_engine<T2, A2>, OT2>>
+{
+    using engine_type_1 = banded_matrix_engine<T1, A1>;
+    using engine_type_2 = banded_matrix_engine<T2, A2>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, engine_type_2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<engine_type_2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1,
+                                 matrix<engine_type_2, OT2> const& m2);
+};
+
+//-------------------------
+//- symmetric_matrix*vector
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<symmetric_packed_engine<T1, A1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type_1 = symmetric_packed_engine<T1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+//-------------------------
+//- symmetric_matrix*matrix
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<symmetric_packed_engine<T1, A1>, OT1>, matrix<ET2, OT2>>
+{
+    using engine_type_1 = symmetric_packed_engine<T1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+//--------------------------
+//- triangular_matrix*vector
+//
+template<class OT, class ET1, class TT1, class DT1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<triangular_engine<ET1, TT1, DT1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type_1 = triangular_engine<ET1, TT1, DT1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+//--------------------------
+//- triangular_matrix*matrix
+//
+template<class OT, class ET1, class TT1, class DT1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<triangular_engine<ET1, TT1, DT1>, OT1>, matrix<ET2, OT2>>
+{
+    using engine_type_1 = triangular_engine<ET1, TT1, DT1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+//------------------------
+//- diagonal_matrix*vector
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<diagonal_engine<T1, A1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type_1 = diagonal_engine<T1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+//------------------------
+//- diagonal_matrix*matrix
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<diagonal_engine<T1, A1>, OT1>, matrix<ET2, OT2>>
+{
+    using engine_type_1 = diagonal_engine<T1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+//---------------------------------
+//- diagonal_matrix*diagonal_matrix
+//
+template<class OT, class T1, class A1, class OT1, class T2, class A2, class OT2>
+struct matrix_multiplication_traits<OT,
+                                    matrix<diagonal_engine<T1, A1>, OT1>,
+                                    matrix<diagonal_engine<T2, A2>, OT2>>
+{
+    using engine_type_1 = diagonal_engine<T1, A1>;
+    using engine_type_2 = diagonal_engine<T2, A2>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, engine_type_2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<engine_type_2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1,
+                                 matrix<engine_type_2, OT2> const& m2);
+};
+
+//------------------------
+//- identity_matrix*vector
+//
+template<class OT, class T1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<identity_engine<T1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type_1 = identity_engine<T1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+//------------------------
+//- identity_matrix*matrix
+//
+template<class OT, class T1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<identity_engine<T1>, OT1>, matrix<ET2, OT2>>
+{
+    using engine_type_1 = identity_engine<T1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+//---------------------------------
+//- identity_matrix*identity_matrix
+//
+template<class OT, class T1, class OT1, class T2, class OT2>
+struct matrix_multiplication_traits<OT,
+                                    matrix<identity_engine<T1>, OT1>,
+                                    matrix<identity_engine<T2>, OT2>>
+{
+    using engine_type_1 = identity_engine<T1>;
+    using engine_type_2 = identity_engine<T2>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, engine_type_2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<engine_type_2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1,
+                                 matrix<engine_type_2, OT2> const& m2);
+};
+
+//------------------------
+//- low_rank_matrix*vector
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<low_rank_engine<T1, A1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type_1 = low_rank_engine<T1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+//------------------------
+//- low_rank_matrix*matrix
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<low_rank_engine<T1, A1>, OT1>, matrix<ET2, OT2>>
+{
+    using engine_type_1 = low_rank_engine<T1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2);
+};
+
+//---------------------------------
+//- low_rank_matrix*low_rank_matrix
+//
+template<class OT, class T1, class A1, class OT1, class T2, class A2, class OT2>
+struct matrix_multiplication_traits<OT,
+                                    matrix<low_rank_engine<T1, A1>, OT1>,
+                                    matrix<low_rank_engine<T2, A2>, OT2>>
+{
+    using engine_type_1 = low_rank_engine<T1, A1>;
+    using engine_type_2 = low_rank_engine<T2, A2>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, engine_type_2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<engine_type_2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1,
+                                 matrix<engine_type_2, OT2> const& m2);
+};
+
+//------------------------
+//- toeplitz_matrix*vector
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<toeplitz_engine<T1, A1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type_1 = toeplitz_engine<T1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+//-------------------------
+//- circulant_matrix*vector
+//
+template<class OT, class T1, class A1, class OT1, class ET2, class OT2>
+struct matrix_multiplication_traits<OT, matrix<circulant_engine<T1, A1>, OT1>, vector<ET2, OT2>>
+{
+    using engine_type_1 = circulant_engine<T1, A1>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, ET2>;
+    using op_traits     = OT;
+    using result_type   = vector<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename vector<ET2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2);
+};
+
+//---------------------------
+//- tiled_matrix*tiled_matrix
+//
+template<class OT, class T1, size_t B, class A1, class LT1, class OT1, class T2, class A2, class LT2, class OT2>
+struct matrix_multiplication_traits<OT,
+                                    matrix<tiled_matrix_engine<T1, B, A1, LT1>, OT1>,
+                                    matrix<tiled_matrix_engine<T2, B, A2, LT2>, OT2>>
+{
+    using engine_type_1 = tiled_matrix_engine<T1, B, A1, LT1>;
+    using engine_type_2 = tiled_matrix_engine<T2, B, A2, LT2>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, engine_type_2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    using size_type_1 = typename matrix<engine_type_1, OT1>::size_type;
+    using size_type_2 = typename matrix<engine_type_2, OT2>::size_type;
+    using size_type_r = typename result_type::size_type;
+
+    static result_type  multiply(matrix<engine_type_1, OT1> const& m1,
+                                 matrix<engine_type_2, OT2> const& m2);
+};
+
+//-------------------------------------
+//- fs_padded_matrix*fs_padded_vector
+//
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class OT1, class T2, size_t A2, class OT2>
+struct matrix_multiplication_traits<OT,
+                                    matrix<fs_padded_matrix_engine<T1, R1, C1, A1>, OT1>,
+                                    vector<fs_padded_vector_engine<T2, C1, A2>, OT2>>
+{
+    using engine_type_1 = fs_padded_matrix_engine<T1, R1, C1, A1>;
+    using engine_type_2 = fs_padded_vector_engine<T2, C1, A2>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, engine_type_2>;
+    using op_traits     = OT;
+    using result_type   = vector<engine_type, op_traits>;
+
+    static constexpr result_type    multiply(matrix<engine_type_1, OT1> const& m1,
+                                             vector<engine_type_2, OT2> const& v2);
+};
+
+//-------------------------------------
+//- fs_padded_matrix*fs_padded_matrix
+//
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class OT1,
+         class T2, size_t C2, size_t A2, class OT2>
+struct matrix_multiplication_traits<OT,
+                                    matrix<fs_padded_matrix_engine<T1, R1, C1, A1>, OT1>,
+                                    matrix<fs_padded_matrix_engine<T2, C1, C2, A2>, OT2>>
+{
+    using engine_type_1 = fs_padded_matrix_engine<T1, R1, C1, A1>;
+    using engine_type_2 = fs_padded_matrix_engine<T2, C1, C2, A2>;
+    using engine_type   = matrix_multiplication_engine_t<OT, engine_type_1, engine_type_2>;
+    using op_traits     = OT;
+    using result_type   = matrix<engine_type, op_traits>;
+
+    static constexpr result_type    multiply(matrix<engine_type_1, OT1> const& m1,
+                                             matrix<engine_type_2, OT2> const& m2);
 };
 
 }       //- STD_LA namespace
@@ -16,7 +16,7 @@ namespace STD_LA {
 //- vector*scalar
 //
 template<class OTR, class ET1, class OT1, class T2>
-inline auto
+constexpr auto
 matrix_multiplication_traits<OTR, vector<ET1, OT1>, T2>::multiply
 (vector<ET1, OT1> const& v1, T2 const& s2) -> result_type
 {
@@ -25,8 +25,8 @@ matrix_multiplication_traits<OTR, vector<ET1, OT1>, T2>::multiply
 	size_type_r const  elems = static_cast<size_type_r>(v1.elements());
 
 	result_type     vr;
-	size_type_r    ir;
-	size_type_1    i1;
+	size_type_r    ir = 0;
+	size_type_1    i1 = 0;
 
 	if constexpr (result_requires_resize(vr))
 	{
@@ -45,7 +45,7 @@ matrix_multiplication_traits<OTR, vector<ET1, OT1>, T2>::multiply
 //- scalar*vector
 //
 template<class OTR, class T1, class ET2, class OT2>
-inline auto
+constexpr auto
 matrix_multiplication_traits<OTR, T1, vector<ET2, OT2>>::multiply
 (T1 const& s1, vector<ET2, OT2> const& v2) -> result_type
 {
@@ -54,8 +54,8 @@ matrix_multiplication_traits<OTR, T1, vector<ET2, OT2>>::multiply
 	size_type_r const  elems = static_cast<size_type_r>(v2.elements());
 
 	result_type     vr;
-	size_type_r     ir;
-	size_type_2     i2;
+	size_type_r     ir = 0;
+	size_type_2     i2 = 0;
 
 	if constexpr (result_requires_resize(vr))
 	{
@@ -74,7 +74,7 @@ matrix_multiplication_traits<OTR, T1, vector<ET2, OT2>>::multiply
 //- matrix*scalar
 //
 template<class OTR, class ET1, class OT1, class T2>
-inline auto
+constexpr auto
 matrix_multiplication_traits<OTR, matrix<ET1, OT1>, T2>::multiply
 (matrix<ET1, OT1> const& m1, T2 const& s2) -> result_type
 {
@@ -84,8 +84,8 @@ matrix_multiplication_traits<OTR, matrix<ET1, OT1>, T2>::multiply
 	size_type_r const  cols = static_cast<size_type_r>(m1.columns());
 
 	result_type		mr;
-	size_type_r    ir, jr;
-	size_type_1    i1, j1;
+	size_type_r    ir = 0, jr = 0;
+	size_type_1    i1 = 0, j1 = 0;
 
 	if constexpr (result_requires_resize(mr))
 	{
@@ -107,7 +107,7 @@ matrix_multiplication_traits<OTR, matrix<ET1, OT1>, T2>::multiply
 //- scalar*matrix
 //
 template<class OTR, class T1, class ET2, class OT2>
-inline auto
+constexpr auto
 matrix_multiplication_traits<OTR, T1, matrix<ET2, OT2>>::multiply
 (T1 const& s1, matrix<ET2, OT2> const& m2) -> result_type
 {
@@ -117,8 +117,8 @@ matrix_multiplication_traits<OTR, T1, matrix<ET2, OT2>>::multiply
 	size_type_r const  cols = static_cast<size_type_r>(m2.columns());
 
 	result_type		mr;
-	size_type_r    ir, jr;
-	size_type_2    i2, j2;
+	size_type_r    ir = 0, jr = 0;
+	size_type_2    i2 = 0, j2 = 0;
 
 	if constexpr (result_requires_resize(mr))
 	{
@@ -140,7 +140,7 @@ matrix_multiplication_traits<OTR, T1, matrix<ET2, OT2>>::multiply
 //- vector*vector
 //
 template<class OTR, class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 matrix_multiplication_traits<OTR, vector<ET1, OT1>, vector<ET2, OT2>>::multiply
 (vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2) -> result_type
 {
@@ -148,9 +148,9 @@ matrix_multiplication_traits<OTR, vector<ET1, OT1>, vector<ET2, OT2>>::multiply
 
 	size_type_1 const  elems = static_cast<size_type_1>(v1.elements());
 
-	result_type     er{};
-	size_type_1    i1;
-	size_type_2    i2;
+	detail::accumulator_t<result_type>  er{};
+	size_type_1    i1 = 0;
+	size_type_2    i2 = 0;
 
 	for (i1 = 0, i2 = 0;  i1 < elems;  ++i1, ++i2)
 	{
@@ -161,10 +161,11 @@ matrix_multiplication_traits<OTR, vector<ET1, OT1>, vector<ET2, OT2>>::multiply
 }
 
 //---------------
-//- matrix*vector
+//- matrix*vector.  When both operands expose a strided layout, the product is computed directly
+//  from their element pointers, except during constant evaluation.
 //
 template<class OTR, class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 matrix_multiplication_traits<OTR, matrix<ET1, OT1>, vector<ET2, OT2>>::multiply
 (matrix<ET1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
 {
@@ -173,10 +174,32 @@ matrix_multiplication_traits<OTR, matrix<ET1, OT1>, vector<ET2, OT2>>::multiply
 	size_type_r const  elems = static_cast<size_type_r>(m1.rows());
 	size_type_1 const  inner = static_cast<size_type_1>(m1.columns());
 
+	if constexpr (detail::has_strided_layout_v<ET1>  &&  detail::has_strided_layout_v<ET2>  &&
+	              detail::is_dense_owning_engine_v<typename result_type::engine_type>)
+	{
+		if (!detail::is_constant_evaluated())
+		{
+			result_type     vr;
+
+			if constexpr (result_requires_resize(vr))
+			{
+				vr.resize(elems);
+			}
+
+			auto const  [a_rs, a_cs] = m1.engine().stride();
+
+			detail::strided_gemv((size_t) elems, (size_t) inner,
+			                     m1.engine().data(), a_rs, a_cs,
+			                     v2.engine().data(), v2.engine().stride(),
+			                     vr.engine().data());
+			return vr;
+		}
+	}
+
 	result_type		vr;
-	size_type_r    ir;
-	size_type_1    i1, k1;
-	size_type_2    k2;
+	size_type_r    ir = 0;
+	size_type_1    i1 = 0, k1 = 0;
+	size_type_2    k2 = 0;
 
 	if constexpr (result_requires_resize(vr))
 	{
@@ -185,7 +208,7 @@ matrix_multiplication_traits<OTR, matrix<ET1, OT1>, vector<ET2, OT2>>::multiply
 
 	for (ir = 0, i1 = 0;  ir < elems;  ++ir, ++i1)
 	{
-		typename result_type::element_type	er{};
+		detail::accumulator_t<typename result_type::element_type>	er{};
 
 		for (k1 = 0, k2 = 0;  k1 < inner;  ++k1, ++k2)
 		{
@@ -202,7 +225,7 @@ matrix_multiplication_traits<OTR, matrix<ET1, OT1>, vector<ET2, OT2>>::multiply
 //- vector*matrix
 //
 template<class OTR, class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 matrix_multiplication_traits<OTR, vector<ET1, OT1>, matrix<ET2, OT2>>::multiply
 (vector<ET1, OT1> const& v1, matrix<ET2, OT2> const& m2) -> result_type
 {
@@ -212,9 +235,9 @@ matrix_multiplication_traits<OTR, vector<ET1, OT1>, matrix<ET2, OT2>>::multiply
 	size_type_2 const  inner = static_cast<size_type_2>(m2.rows());
 
 	result_type		vr;
-	size_type_r    jr;
-	size_type_1    k1;
-	size_type_2    k2, j2;
+	size_type_r    jr = 0;
+	size_type_1    k1 = 0;
+	size_type_2    k2 = 0, j2 = 0;
 
 	if constexpr (result_requires_resize(vr))
 	{
@@ -223,7 +246,7 @@ matrix_multiplication_traits<OTR, vector<ET1, OT1>, matrix<ET2, OT2>>::multiply
 
 	for (jr = 0, j2 = 0;  jr < elems;  ++jr, ++j2)
 	{
-		typename result_type::element_type	er{};
+		detail::accumulator_t<typename result_type::element_type>	er{};
 
 		for (k1 = 0, k2 = 0;  k2 < inner;  ++k1, ++k2)
 		{
@@ -237,10 +260,14 @@ matrix_multiplication_traits<OTR, vector<ET1, OT1>, matrix<ET2, OT2>>::multiply
 }
 
 //---------------
-//- matrix*matrix
+//- matrix*matrix.  When the right-hand operand is a diagonal matrix, the product scales the
+//  columns of the left-hand operand; when it is an identity matrix, the product is a copy of the
+//  left-hand operand.  When it is a low-rank matrix U * V.t(), the product is evaluated as
+//  (m1 * U) * V.t().  When both operands expose a strided layout, the product is computed
+//  directly from their element pointers, except during constant evaluation.
 //
 template<class OTR, class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 matrix_multiplication_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply
 (matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
 {
@@ -250,10 +277,124 @@ matrix_multiplication_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply
 	size_type_r const  cols  = static_cast<size_type_r>(m2.columns());
 	size_type_1 const  inner = m1.columns();
 
+	if (static_cast<size_t>(inner) != static_cast<size_t>(m2.rows()))
+	{
+		throw runtime_error("invalid size");
+	}
+
+	if constexpr (detail::is_identity_engine_v<ET2>)
+	{
+		result_type     mr;
+
+		mr = m1;
+		return mr;
+	}
+	else if constexpr (detail::is_diagonal_engine_v<ET2>)
+	{
+		auto const* const   p_diag = m2.engine().diagonal_data();
+		result_type         mr;
+
+		if constexpr (result_requires_resize(mr))
+		{
+			mr.resize(rows, cols);
+		}
+
+		detail::parallel_for(0, rows, rows * cols, [&](size_t first, size_t last)
+		{
+			for (size_type_r ir = first;  ir < last;  ++ir)
+			{
+				size_type_1 const   i1 = static_cast<size_type_1>(ir);
+				size_type_1         j1;
+				size_type_r         jr;
+
+				for (jr = 0, j1 = 0;  jr < cols;  ++jr, ++j1)
+				{
+					mr(ir, jr) = m1(i1, j1) * p_diag[jr];
+				}
+			}
+		});
+
+		return mr;
+	}
+	else if constexpr (detail::is_low_rank_engine_v<ET2>)
+	{
+		using elem_type_r = typename result_type::element_type;
+		using acc_type    = detail::accumulator_t<elem_type_r>;
+
+		auto const* const   p_u   = m2.engine().left_factor_data();
+		auto const* const   p_v   = m2.engine().right_factor_data();
+		size_t const        rank  = m2.engine().rank();
+		result_type         mr;
+
+		if constexpr (result_requires_resize(mr))
+		{
+			mr.resize(rows, cols);
+		}
+
+		detail::parallel_for(0, rows, rows * (inner + cols) * rank, [&](size_t first, size_t last)
+		{
+			std::vector<acc_type>   au(rank);
+
+			for (size_type_r ir = first;  ir < last;  ++ir)
+			{
+				size_type_1 const   i1 = static_cast<size_type_1>(ir);
+				size_type_1         k1;
+				size_type_r         jr;
+
+				fill(au.begin(), au.end(), acc_type{});
+				for (k1 = 0;  k1 < inner;  ++k1)
+				{
+					auto const          a1  = m1(i1, k1);
+					auto const* const   p_r = p_u + static_cast<size_t>(k1)*rank;
+
+					for (size_t p = 0;  p < rank;  ++p)
+					{
+						au[p] += a1 * p_r[p];
+					}
+				}
+				for (jr = 0;  jr < cols;  ++jr)
+				{
+					auto const* const   p_r = p_v + static_cast<size_t>(jr)*rank;
+					acc_type            er{};
+
+					for (size_t p = 0;  p < rank;  ++p)
+					{
+						er += au[p] * p_r[p];
+					}
+					mr(ir, jr) = static_cast<elem_type_r>(er);
+				}
+			}
+		});
+
+		return mr;
+	}
+	else if constexpr (detail::has_strided_layout_v<ET1>  &&  detail::has_strided_layout_v<ET2>  &&
+	                   detail::is_dense_owning_engine_v<typename result_type::engine_type>)
+	{
+		if (!detail::is_constant_evaluated())
+		{
+			result_type     mr;
+
+			if constexpr (result_requires_resize(mr))
+			{
+				mr.resize(rows, cols);
+			}
+
+			auto const  [a_rs, a_cs] = m1.engine().stride();
+			auto const  [b_rs, b_cs] = m2.engine().stride();
+
+			detail::strided_gemm((size_t) rows, (size_t) cols, (size_t) inner,
+			                     m1.engine().data(), a_rs, a_cs,
+			                     m2.engine().data(), b_rs, b_cs,
+			                     mr.engine().data(), get<0>(mr.engine().stride()));
+			return mr;
+		}
+	}
+
 	result_type		mr;
-	size_type_r    ir, jr;
-	size_type_1    i1, k1;
-	size_type_2    j2, k2;
+	size_type_r    ir = 0, jr = 0;
+	size_type_1    i1 = 0, k1 = 0;
+	size_type_2    j2 = 0, k2 = 0;
 
 	if constexpr (result_requires_resize(mr))
 	{
@@ -264,7 +405,7 @@ matrix_multiplication_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply
 	{
 		for (jr = 0, j2 = 0;  jr < cols;  ++jr, ++j2)
 		{
-			typename result_type::element_type  er{};
+			detail::accumulator_t<typename result_type::element_type>  er{};
 
 			for (k1 = 0, k2 = 0;  k1 < inner;  ++k1, ++k2)
 			{
@@ -277,5 +418,1442 @@ matrix_multiplication_traits<OTR, matrix<ET1, OT1>, matrix<ET2, OT2>>::multiply
 	return mr;
 }
 
+//-------------------------------------------------------------------
+//- csr_matrix*vector.  Each task computes a contiguous block of rows.
+//
+template<class OTR, class T1, class IT1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<csr_matrix_engine<T1, IT1, A1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (csr*v)", m1, v2);
+
+    if (static_cast<size_t>(m1.columns()) != static_cast<size_t>(v2.size()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    engine_type_1 const&    e1     = m1.engine();
+    size_type_r const       elems  = static_cast<size_type_r>(m1.rows());
+    IT1 const* const        p_offs = e1.row_offsets();
+    IT1 const* const        p_cols = e1.column_indices();
+    T1 const* const         p_vals = e1.values();
+
+    result_type     vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(elems);
+    }
+
+    detail::parallel_for(0, elems, e1.nonzeros(), [&](size_t first, size_t last)
+    {
+        for (size_type_r ir = first;  ir < last;  ++ir)
+        {
+            typename result_type::element_type  er{};
+            size_type_1 const   k_last = static_cast<size_type_1>(p_offs[ir + 1]);
+
+            for (size_type_1 k1 = static_cast<size_type_1>(p_offs[ir]);  k1 < k_last;  ++k1)
+            {
+                er += p_vals[k1] * v2(static_cast<size_type_2>(p_cols[k1]));
+            }
+            vr(ir) = er;
+        }
+    });
+
+    return vr;
+}
+
+//-------------------------------------------------------------------
+//- csr_matrix*matrix.  Each task computes a contiguous block of rows.
+//
+template<class OTR, class T1, class IT1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<csr_matrix_engine<T1, IT1, A1>, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (csr*m)", m1, m2);
+
+    if (static_cast<size_t>(m1.columns()) != static_cast<size_t>(m2.rows()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    engine_type_1 const&    e1     = m1.engine();
+    size_type_r const       rows   = static_cast<size_type_r>(m1.rows());
+    size_type_r const       cols   = static_cast<size_type_r>(m2.columns());
+    IT1 const* const        p_offs = e1.row_offsets();
+    IT1 const* const        p_cols = e1.column_indices();
+    T1 const* const         p_vals = e1.values();
+
+    result_type     mr;
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(rows, cols);
+    }
+
+    detail::parallel_for(0, rows, e1.nonzeros() * cols, [&](size_t first, size_t last)
+    {
+        using elem_type_r = typename result_type::element_type;
+
+        for (size_type_r ir = first;  ir < last;  ++ir)
+        {
+            for (size_type_r jr = 0;  jr < cols;  ++jr)
+            {
+                mr(ir, jr) = elem_type_r{};
+            }
+
+            size_type_1 const   k_last = static_cast<size_type_1>(p_offs[ir + 1]);
+
+            for (size_type_1 k1 = static_cast<size_type_1>(p_offs[ir]);  k1 < k_last;  ++k1)
+            {
+                auto const          a1 = p_vals[k1];
+                size_type_2 const   k2 = static_cast<size_type_2>(p_cols[k1]);
+                size_type_2         j2;
+                size_type_r         jr;
+
+                for (jr = 0, j2 = 0;  jr < cols;  ++jr, ++j2)
+                {
+                    mr(ir, jr) += a1 * m2(k2, j2);
+                }
+            }
+        }
+    });
+
+    return mr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- csr_matrix*csr_matrix.  This is a two-pass row-by-row (Gustavson) product.  The symbolic pass
+//  counts the distinct columns in each row of the result, which fixes the row offsets; the numeric
+//  pass then scatters each row's products into a dense accumulator and gathers them in column
+//  order.  Each task owns its own marker and accumulator arrays, sized by the result's columns.
+//
+template<class OTR, class T1, class IT1, class A1, class OT1, class T2, class IT2, class A2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR,
+                             matrix<csr_matrix_engine<T1, IT1, A1>, OT1>,
+                             matrix<csr_matrix_engine<T2, IT2, A2>, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<engine_type_2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (csr*csr)", m1, m2);
+
+    using elem_type_r   = typename engine_type::element_type;
+    using index_type_r  = typename engine_type::index_type;
+    using index_array   = typename engine_type::index_array;
+    using element_array = typename engine_type::element_array;
+
+    engine_type_1 const&    e1      = m1.engine();
+    engine_type_2 const&    e2      = m2.engine();
+    size_type_r const       rows    = static_cast<size_type_r>(m1.rows());
+    size_type_r const       cols    = static_cast<size_type_r>(m2.columns());
+    IT1 const* const        p_offs1 = e1.row_offsets();
+    IT1 const* const        p_cols1 = e1.column_indices();
+    T1 const* const         p_vals1 = e1.values();
+    IT2 const* const        p_offs2 = e2.row_offsets();
+    IT2 const* const        p_cols2 = e2.column_indices();
+    T2 const* const         p_vals2 = e2.values();
+
+    if (m1.columns() != m2.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_t const    avg_nnz2 = (e2.rows() == 0) ? 0 : (e2.nonzeros() / e2.rows()) + 1;
+    size_t const    work     = e1.nonzeros() * avg_nnz2;
+    size_t const    no_row   = numeric_limits<size_t>::max();
+
+    //- Symbolic pass: count the distinct columns in each row of the result.
+    //
+    std::vector<size_t>     row_nnz(rows + 1, 0u);
+
+    detail::parallel_for(0, rows, work, [&](size_t first, size_t last)
+    {
+        std::vector<size_t>     marker(cols, no_row);
+
+        for (size_type_r ir = first;  ir < last;  ++ir)
+        {
+            size_t      n = 0;
+
+            for (size_t k1 = p_offs1[ir];  k1 < static_cast<size_t>(p_offs1[ir + 1]);  ++k1)
+            {
+                size_t const    k2 = static_cast<size_t>(p_cols1[k1]);
+
+                for (size_t k = p_offs2[k2];  k < static_cast<size_t>(p_offs2[k2 + 1]);  ++k)
+                {
+                    size_t const    jr = static_cast<size_t>(p_cols2[k]);
+
+                    if (marker[jr] != ir)
+                    {
+                        marker[jr] = ir;
+                        ++n;
+                    }
+                }
+            }
+            row_nnz[ir + 1] = n;
+        }
+    });
+
+    for (size_type_r ir = 0;  ir < rows;  ++ir)
+    {
+        row_nnz[ir + 1] += row_nnz[ir];
+    }
+
+    if (row_nnz[rows] > static_cast<size_t>(numeric_limits<index_type_r>::max()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    //- Numeric pass: accumulate each row densely, then gather its elements in column order.
+    //
+    index_array     offsets(rows + 1);
+    index_array     indices(row_nnz[rows]);
+    element_array   values(row_nnz[rows]);
+
+    detail::parallel_for(0, rows, work, [&](size_t first, size_t last)
+    {
+        std::vector<size_t>         marker(cols, no_row);
+        std::vector<elem_type_r>    accum(cols);
+
+        for (size_type_r ir = first;  ir < last;  ++ir)
+        {
+            size_t const    row_first = row_nnz[ir];
+            size_t          n         = row_first;
+
+            for (size_t k1 = p_offs1[ir];  k1 < static_cast<size_t>(p_offs1[ir + 1]);  ++k1)
+            {
+                auto const      a1 = p_vals1[k1];
+                size_t const    k2 = static_cast<size_t>(p_cols1[k1]);
+
+                for (size_t k = p_offs2[k2];  k < static_cast<size_t>(p_offs2[k2 + 1]);  ++k)
+                {
+                    size_t const    jr = static_cast<size_t>(p_cols2[k]);
+
+                    if (marker[jr] != ir)
+                    {
+                        marker[jr] = ir;
+                        accum[jr]  = a1 * p_vals2[k];
+                        indices[n++] = static_cast<index_type_r>(jr);
+                    }
+                    else
+                    {
+                        accum[jr] += a1 * p_vals2[k];
+                    }
+                }
+            }
+
+            sort(indices.begin() + row_first, indices.begin() + n);
+
+            for (size_t k = row_first;  k < n;  ++k)
+            {
+                values[k] = accum[static_cast<size_t>(indices[k])];
+            }
+            offsets[ir + 1] = static_cast<index_type_r>(n);
+        }
+    });
+    offsets[0] = 0;
+
+    return result_type(engine_type(rows, cols, std::move(offsets), std::move(indices), std::move(values)));
+}
+
+//--------------------------------------------------------------------------------------------------
+//- bsr_matrix*vector.  Each task computes a contiguous block of block rows; the B x B block
+//  products are fixed-size loops that the compiler can fully unroll.
+//
+template<class OTR, class T1, size_t B1, class IT1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<bsr_matrix_engine<T1, B1, IT1, A1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (bsr*v)", m1, v2);
+
+    using elem_type_r = typename result_type::element_type;
+    using block_type  = typename engine_type_1::block_type;
+
+    engine_type_1 const&    e1     = m1.engine();
+    size_type_r const       elems  = static_cast<size_type_r>(m1.rows());
+    size_t const            brows  = e1.block_rows();
+    IT1 const* const        p_offs = e1.row_offsets();
+    IT1 const* const        p_cols = e1.column_indices();
+    block_type const* const p_blks = e1.blocks();
+
+    result_type     vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(elems);
+    }
+
+    detail::parallel_for(0, brows, e1.nonzero_blocks() * B1 * B1, [&](size_t first, size_t last)
+    {
+        for (size_t bi = first;  bi < last;  ++bi)
+        {
+            elem_type_r     acc[B1] = {};
+            size_t const    k_last  = static_cast<size_t>(p_offs[bi + 1]);
+
+            for (size_t k = static_cast<size_t>(p_offs[bi]);  k < k_last;  ++k)
+            {
+                block_type const&   blk = p_blks[k];
+                size_type_2 const   j2  = static_cast<size_type_2>(p_cols[k]) * B1;
+                elem_type_r         x[B1];
+
+                for (size_t c = 0;  c < B1;  ++c)
+                {
+                    x[c] = static_cast<elem_type_r>(v2(j2 + c));
+                }
+                for (size_t r = 0;  r < B1;  ++r)
+                {
+                    for (size_t c = 0;  c < B1;  ++c)
+                    {
+                        acc[r] += blk(r, c) * x[c];
+                    }
+                }
+            }
+
+            for (size_t r = 0;  r < B1;  ++r)
+            {
+                vr(static_cast<size_type_r>(bi * B1 + r)) = acc[r];
+            }
+        }
+    });
+
+    return vr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- bsr_matrix*matrix.  Each task computes a contiguous block of block rows, applying each stored
+//  block to the corresponding B-row panel of the right-hand operand one column at a time.
+//
+template<class OTR, class T1, size_t B1, class IT1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<bsr_matrix_engine<T1, B1, IT1, A1>, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (bsr*m)", m1, m2);
+
+    using elem_type_r = typename result_type::element_type;
+    using block_type  = typename engine_type_1::block_type;
+
+    engine_type_1 const&    e1     = m1.engine();
+    size_type_r const       rows   = static_cast<size_type_r>(m1.rows());
+    size_type_r const       cols   = static_cast<size_type_r>(m2.columns());
+    size_t const            brows  = e1.block_rows();
+    IT1 const* const        p_offs = e1.row_offsets();
+    IT1 const* const        p_cols = e1.column_indices();
+    block_type const* const p_blks = e1.blocks();
+
+    result_type     mr;
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(rows, cols);
+    }
+
+    detail::parallel_for(0, brows, e1.nonzero_blocks() * B1 * B1 * cols, [&](size_t first, size_t last)
+    {
+        for (size_t bi = first;  bi < last;  ++bi)
+        {
+            size_type_r const   ir     = static_cast<size_type_r>(bi * B1);
+            size_t const        k_last = static_cast<size_t>(p_offs[bi + 1]);
+
+            for (size_type_r jr = 0;  jr < cols;  ++jr)
+            {
+                elem_type_r     acc[B1] = {};
+                size_type_2     j2      = static_cast<size_type_2>(jr);
+
+                for (size_t k = static_cast<size_t>(p_offs[bi]);  k < k_last;  ++k)
+                {
+                    block_type const&   blk = p_blks[k];
+                    size_type_2 const   k2  = static_cast<size_type_2>(p_cols[k]) * B1;
+                    elem_type_r         x[B1];
+
+                    for (size_t c = 0;  c < B1;  ++c)
+                    {
+                        x[c] = static_cast<elem_type_r>(m2(k2 + c, j2));
+                    }
+                    for (size_t r = 0;  r < B1;  ++r)
+                    {
+                        for (size_t c = 0;  c < B1;  ++c)
+                        {
+                            acc[r] += blk(r, c) * x[c];
+                        }
+                    }
+                }
+
+                for (size_t r = 0;  r < B1;  ++r)
+                {
+                    mr(ir + r, jr) = acc[r];
+                }
+            }
+        }
+    });
+
+    return mr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- banded_matrix*vector.  Each task computes a contiguous block of rows, visiting only the
+//  elements of each row that lie within the band.
+//
+template<class OTR, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<banded_matrix_engine<T1, A1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (band*v)", m1, v2);
+
+    engine_type_1 const&    e1     = m1.engine();
+    size_type_r const       elems  = static_cast<size_type_r>(m1.rows());
+    size_t const            cols   = e1.columns();
+    size_t const            kl     = e1.lower_bandwidth();
+    size_t const            ku     = e1.upper_bandwidth();
+    size_t const            width  = e1.band_width();
+    T1 const* const         p_band = e1.band_data();
+
+    result_type     vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(elems);
+    }
+
+    detail::parallel_for(0, elems, elems * width, [&](size_t first, size_t last)
+    {
+        for (size_type_r ir = first;  ir < last;  ++ir)
+        {
+            typename result_type::element_type  er{};
+            size_t const        j_first = (ir > kl) ? ir - kl : 0;
+            size_t const        j_last  = min(cols, ir + ku + 1);
+            T1 const* const     p_row   = p_band + ir*width + kl - ir;
+
+            for (size_t j = j_first;  j < j_last;  ++j)
+            {
+                er += p_row[j] * v2(static_cast<size_type_2>(j));
+            }
+            vr(ir) = er;
+        }
+    });
+
+    return vr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- banded_matrix*matrix.  Each task computes a contiguous block of rows, visiting only the
+//  elements of each row that lie within the band.
+//
+template<class OTR, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<banded_matrix_engine<T1, A1>, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (band*m)", m1, m2);
+
+    engine_type_1 const&    e1     = m1.engine();
+    size_type_r const       rows   = static_cast<size_type_r>(m1.rows());
+    size_type_r const       cols   = static_cast<size_type_r>(m2.columns());
+    size_t const            inner  = e1.columns();
+    size_t const            kl     = e1.lower_bandwidth();
+    size_t const            ku     = e1.upper_bandwidth();
+    size_t const            width  = e1.band_width();
+    T1 const* const         p_band = e1.band_data();
+
+    result_type     mr;
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(rows, cols);
+    }
+
+    detail::parallel_for(0, rows, rows * width * cols, [&](size_t first, size_t last)
+    {
+        using elem_type_r = typename result_type::element_type;
+
+        for (size_type_r ir = first;  ir < last;  ++ir)
+        {
+            size_t const        k_first = (ir > kl) ? ir - kl : 0;
+            size_t const        k_last  = min(inner, ir + ku + 1);
+            T1 const* const     p_row   = p_band + ir*width + kl - ir;
+
+            for (size_type_r jr = 0;  jr < cols;  ++jr)
+            {
+                elem_type_r         er{};
+                size_type_2 const   j2 = static_cast<size_type_2>(jr);
+
+                for (size_t k = k_first;  k < k_last;  ++k)
+                {
+                    er += p_row[k] * m2(static_cast<size_type_2>(k), j2);
+                }
+                mr(ir, jr) = er;
+            }
+        }
+    });
+
+    return mr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- banded_matrix*banded_matrix.  Element (i, j) of the result is the sum over the intersection of
+//  the band of row i of the left operand and the band of column j of the right operand.
+//
+template<class OTR, class T1, class A1, class OT1, class T2, class A2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR,
+                             matrix<banded_matrix_engine<T1, A1>, OT1>,
+                             matrix<banded_matrix_engine<T2, A2>, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<engine_type_2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (band*band)", m1, m2);
+
+    engine_type_1 const&    e1     = m1.engine();
+    engine_type_2 const&    e2     = m2.engine();
+    size_t const            rows   = e1.rows();
+    size_t const            cols   = e2.columns();
+    size_t const            inner  = e1.columns();
+    size_t const            kl1    = e1.lower_bandwidth();
+    size_t const            ku1    = e1.upper_bandwidth();
+    size_t const            kl2    = e2.lower_bandwidth();
+    size_t const            ku2    = e2.upper_bandwidth();
+    size_t const            kl     = kl1 + kl2;
+    size_t const            ku     = ku1 + ku2;
+
+    if (inner != e2.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    engine_type     er(rows, cols, kl, ku);
+
+    detail::parallel_for(0, rows, rows * e1.band_width() * e2.band_width(), [&](size_t first, size_t last)
+    {
+        for (size_t i = first;  i < last;  ++i)
+        {
+            size_t const    j_first = (i > kl) ? i - kl : 0;
+            size_t const    j_last  = min(cols, i + ku + 1);
+
+            for (size_t j = j_first;  j < j_last;  ++j)
+            {
+                size_t const    k_first = max((i > kl1) ? i - kl1 : 0, (j > ku2) ? j - ku2 : 0);
+                size_t const    k_last  = min(inner, min(i + ku1 + 1, j + kl2 + 1));
+
+                typename engine_type::value_type    sum{};
+
+                for (size_t k = k_first;  k < k_last;  ++k)
+                {
+                    sum += e1.band_element(i, k) * e2.band_element(k, j);
+                }
+                er.band_element(i, j) = sum;
+            }
+        }
+    });
+
+    return result_type(std::move(er));
+}
+
+//--------------------------------------------------------------------------------------------------
+//- symmetric_matrix*vector.  Each task computes a contiguous block of rows; the part of each row
+//  left of the diagonal is read from the packed row, and the rest from the packed column.
+//
+template<class OTR, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<symmetric_packed_engine<T1, A1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (sym*v)", m1, v2);
+
+    engine_type_1 const&    e1     = m1.engine();
+    size_type_r const       elems  = static_cast<size_type_r>(m1.rows());
+    T1 const* const         p_pack = e1.packed_data();
+
+    result_type     vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(elems);
+    }
+
+    detail::parallel_for(0, elems, elems * elems, [&](size_t first, size_t last)
+    {
+        for (size_type_r ir = first;  ir < last;  ++ir)
+        {
+            detail::accumulator_t<typename result_type::element_type>  er{};
+            T1 const* const     p_row = p_pack + ir*(ir + 1)/2;
+            size_t              j;
+
+            for (j = 0;  j <= ir;  ++j)
+            {
+                er += p_row[j] * v2(static_cast<size_type_2>(j));
+            }
+            for (;  j < elems;  ++j)
+            {
+                er += p_pack[j*(j + 1)/2 + ir] * v2(static_cast<size_type_2>(j));
+            }
+            vr(ir) = static_cast<typename result_type::element_type>(er);
+        }
+    });
+
+    return vr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- symmetric_matrix*matrix.  Each task computes a contiguous block of rows, each of which is a
+//  linear combination of the rows of the right-hand operand.
+//
+template<class OTR, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<symmetric_packed_engine<T1, A1>, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (sym*m)", m1, m2);
+
+    engine_type_1 const&    e1     = m1.engine();
+    size_type_r const       rows   = static_cast<size_type_r>(m1.rows());
+    size_type_r const       cols   = static_cast<size_type_r>(m2.columns());
+    T1 const* const         p_pack = e1.packed_data();
+
+    result_type     mr;
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(rows, cols);
+    }
+
+    detail::parallel_for(0, rows, rows * rows * cols, [&](size_t first, size_t last)
+    {
+        using elem_type_r = typename result_type::element_type;
+        using acc_type    = detail::accumulator_t<elem_type_r>;
+
+        std::vector<acc_type>   row(cols);
+
+        for (size_type_r ir = first;  ir < last;  ++ir)
+        {
+            fill(row.begin(), row.end(), acc_type{});
+
+            for (size_t k = 0;  k < rows;  ++k)
+            {
+                auto const          a1 = p_pack[engine_type_1::packed_index(ir, k)];
+                size_type_2 const   k2 = static_cast<size_type_2>(k);
+                size_type_2         j2;
+                size_type_r         jr;
+
+                for (jr = 0, j2 = 0;  jr < cols;  ++jr, ++j2)
+                {
+                    row[jr] += a1 * m2(k2, j2);
+                }
+            }
+
+            for (size_type_r jr = 0;  jr < cols;  ++jr)
+            {
+                mr(ir, jr) = static_cast<elem_type_r>(row[jr]);
+            }
+        }
+    });
+
+    return mr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- triangular_matrix*vector.  Only the elements of each row within the triangle are visited, and
+//  the rows are divided among the tasks so that each gets a similar share of the triangle.
+//
+template<class OTR, class ET1, class TT1, class DT1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<triangular_engine<ET1, TT1, DT1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (tri*v)", m1, v2);
+
+    using elem_type_r   = typename result_type::element_type;
+    using ref_size_type = typename ET1::size_type;
+
+    ET1 const&          e1    = m1.engine().referent();
+    size_type_r const   elems = static_cast<size_type_r>(m1.rows());
+    size_t const        cols  = static_cast<size_t>(m1.columns());
+
+    result_type     vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(elems);
+    }
+
+    detail::parallel_for_triangle(elems, elems * cols / 2, [&](size_t first, size_t last)
+    {
+        for (size_t t = first;  t < last;  ++t)
+        {
+            size_t const    ir      = engine_type_1::is_upper ? elems - 1 - t : t;
+            size_t          j_first = engine_type_1::is_upper ? ir : 0;
+            size_t          j_last  = engine_type_1::is_upper ? cols : min(cols, ir + 1);
+            elem_type_r     er{};
+
+            if constexpr (engine_type_1::is_unit)
+            {
+                if (ir < cols)
+                {
+                    er = static_cast<elem_type_r>(v2(static_cast<size_type_2>(ir)));
+                    (engine_type_1::is_upper) ? ++j_first : --j_last;
+                }
+            }
+
+            for (size_t j = j_first;  j < j_last;  ++j)
+            {
+                er += e1(static_cast<ref_size_type>(ir), static_cast<ref_size_type>(j)) *
+                      v2(static_cast<size_type_2>(j));
+            }
+            vr(static_cast<size_type_r>(ir)) = er;
+        }
+    });
+
+    return vr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- triangular_matrix*matrix.  Each row of the result is a linear combination of those rows of the
+//  right-hand operand selected by the triangle, with rows divided among the tasks as above.
+//
+template<class OTR, class ET1, class TT1, class DT1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<triangular_engine<ET1, TT1, DT1>, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (tri*m)", m1, m2);
+
+    using elem_type_r   = typename result_type::element_type;
+    using ref_size_type = typename ET1::size_type;
+
+    ET1 const&          e1    = m1.engine().referent();
+    size_type_r const   rows  = static_cast<size_type_r>(m1.rows());
+    size_type_r const   cols  = static_cast<size_type_r>(m2.columns());
+    size_t const        inner = static_cast<size_t>(m1.columns());
+
+    result_type     mr;
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(rows, cols);
+    }
+
+    detail::parallel_for_triangle(rows, rows * inner * cols / 2, [&](size_t first, size_t last)
+    {
+        for (size_t t = first;  t < last;  ++t)
+        {
+            size_type_r const   ir      = engine_type_1::is_upper ? rows - 1 - t : t;
+            size_t              k_first = engine_type_1::is_upper ? ir : 0;
+            size_t              k_last  = engine_type_1::is_upper ? inner : min(inner, ir + 1);
+            size_type_2         j2;
+            size_type_r         jr;
+
+            for (jr = 0;  jr < cols;  ++jr)
+            {
+                mr(ir, jr) = elem_type_r{};
+            }
+
+            if constexpr (engine_type_1::is_unit)
+            {
+                if (ir < inner)
+                {
+                    for (jr = 0, j2 = 0;  jr < cols;  ++jr, ++j2)
+                    {
+                        mr(ir, jr) = static_cast<elem_type_r>(m2(static_cast<size_type_2>(ir), j2));
+                    }
+                    (engine_type_1::is_upper) ? ++k_first : --k_last;
+                }
+            }
+
+            for (size_t k = k_first;  k < k_last;  ++k)
+            {
+                auto const          a1 = e1(static_cast<ref_size_type>(ir), static_cast<ref_size_type>(k));
+                size_type_2 const   k2 = static_cast<size_type_2>(k);
+
+                for (jr = 0, j2 = 0;  jr < cols;  ++jr, ++j2)
+                {
+                    mr(ir, jr) += a1 * m2(k2, j2);
+                }
+            }
+        }
+    });
+
+    return mr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- diagonal_matrix*vector.  Each element of the vector is scaled by the corresponding diagonal
+//  element.
+//
+template<class OTR, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<diagonal_engine<T1, A1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (diag*v)", m1, v2);
+
+    if (static_cast<size_t>(m1.columns()) != static_cast<size_t>(v2.size()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_type_r const   elems  = static_cast<size_type_r>(m1.rows());
+    T1 const* const     p_diag = m1.engine().diagonal_data();
+
+    result_type     vr;
+    size_type_r     ir;
+    size_type_2     i2;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(elems);
+    }
+
+    for (ir = 0, i2 = 0;  ir < elems;  ++ir, ++i2)
+    {
+        vr(ir) = p_diag[ir] * v2(i2);
+    }
+
+    return vr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- diagonal_matrix*matrix.  Each row of the right-hand operand is scaled by the corresponding
+//  diagonal element.
+//
+template<class OTR, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<diagonal_engine<T1, A1>, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (diag*m)", m1, m2);
+
+    if (static_cast<size_t>(m1.columns()) != static_cast<size_t>(m2.rows()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_type_r const   rows   = static_cast<size_type_r>(m1.rows());
+    size_type_r const   cols   = static_cast<size_type_r>(m2.columns());
+    T1 const* const     p_diag = m1.engine().diagonal_data();
+
+    result_type     mr;
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(rows, cols);
+    }
+
+    detail::parallel_for(0, rows, rows * cols, [&](size_t first, size_t last)
+    {
+        for (size_type_r ir = first;  ir < last;  ++ir)
+        {
+            auto const          d1 = p_diag[ir];
+            size_type_2 const   i2 = static_cast<size_type_2>(ir);
+            size_type_2         j2;
+            size_type_r         jr;
+
+            for (jr = 0, j2 = 0;  jr < cols;  ++jr, ++j2)
+            {
+                mr(ir, jr) = d1 * m2(i2, j2);
+            }
+        }
+    });
+
+    return mr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- diagonal_matrix*diagonal_matrix.  The diagonals are multiplied element-wise.
+//
+template<class OTR, class T1, class A1, class OT1, class T2, class A2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR,
+                             matrix<diagonal_engine<T1, A1>, OT1>,
+                             matrix<diagonal_engine<T2, A2>, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<engine_type_2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (diag*diag)", m1, m2);
+
+    if (static_cast<size_t>(m1.columns()) != static_cast<size_t>(m2.rows()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    size_t const        elems = static_cast<size_t>(m1.rows());
+    T1 const* const     p_d1  = m1.engine().diagonal_data();
+    T2 const* const     p_d2  = m2.engine().diagonal_data();
+
+    engine_type     er(elems);
+
+    for (size_t i = 0;  i < elems;  ++i)
+    {
+        er.diagonal_element(i) = p_d1[i] * p_d2[i];
+    }
+
+    return result_type(std::move(er));
+}
+
+//--------------------------------------------------------------------------------------------------
+//- identity_matrix*vector.  The product is a copy of the vector.
+//
+template<class OTR, class T1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<identity_engine<T1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (id*v)", m1, v2);
+
+    if (static_cast<size_t>(m1.columns()) != static_cast<size_t>(v2.size()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    result_type     vr;
+
+    vr = v2;
+    return vr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- identity_matrix*matrix.  The product is a copy of the right-hand operand.
+//
+template<class OTR, class T1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<identity_engine<T1>, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (id*m)", m1, m2);
+
+    if (static_cast<size_t>(m1.columns()) != static_cast<size_t>(m2.rows()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    result_type     mr;
+
+    mr = m2;
+    return mr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- identity_matrix*identity_matrix.  The product is an identity matrix of the same size.
+//
+template<class OTR, class T1, class OT1, class T2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR,
+                             matrix<identity_engine<T1>, OT1>,
+                             matrix<identity_engine<T2>, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<engine_type_2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (id*id)", m1, m2);
+
+    if (static_cast<size_t>(m1.columns()) != static_cast<size_t>(m2.rows()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    return result_type(engine_type(static_cast<size_t>(m1.rows())));
+}
+
+//--------------------------------------------------------------------------------------------------
+//- low_rank_matrix*vector.  The product U * V.t() * v2 is evaluated as U * (V.t() * v2), which
+//  requires (m + n) * k operations rather than m * n.
+//
+template<class OTR, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<low_rank_engine<T1, A1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (lr*v)", m1, v2);
+
+    using elem_type_r = typename result_type::element_type;
+    using acc_type    = detail::accumulator_t<elem_type_r>;
+
+    engine_type_1 const&    e1    = m1.engine();
+    size_type_r const       elems = static_cast<size_type_r>(m1.rows());
+    size_t const            inner = static_cast<size_t>(m1.columns());
+    size_t const            rank  = e1.rank();
+    T1 const* const         p_u   = e1.left_factor_data();
+    T1 const* const         p_v   = e1.right_factor_data();
+
+    result_type             vr;
+    std::vector<acc_type>   vtv(rank);
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(elems);
+    }
+
+    for (size_t j = 0;  j < inner;  ++j)
+    {
+        auto const          x2  = v2(static_cast<size_type_2>(j));
+        T1 const* const     p_r = p_v + j*rank;
+
+        for (size_t p = 0;  p < rank;  ++p)
+        {
+            vtv[p] += p_r[p] * x2;
+        }
+    }
+
+    detail::parallel_for(0, elems, elems * rank, [&](size_t first, size_t last)
+    {
+        for (size_type_r ir = first;  ir < last;  ++ir)
+        {
+            T1 const* const     p_r = p_u + ir*rank;
+            acc_type            er{};
+
+            for (size_t p = 0;  p < rank;  ++p)
+            {
+                er += p_r[p] * vtv[p];
+            }
+            vr(ir) = static_cast<elem_type_r>(er);
+        }
+    });
+
+    return vr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- low_rank_matrix*matrix.  The product U * V.t() * m2 is evaluated as U * (V.t() * m2); the rows
+//  of the k x p intermediate are divided among the tasks, and then the rows of the result.
+//
+template<class OTR, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<low_rank_engine<T1, A1>, OT1>, matrix<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (lr*m)", m1, m2);
+
+    using elem_type_r = typename result_type::element_type;
+    using acc_type    = detail::accumulator_t<elem_type_r>;
+
+    engine_type_1 const&    e1    = m1.engine();
+    size_type_r const       rows  = static_cast<size_type_r>(m1.rows());
+    size_type_r const       cols  = static_cast<size_type_r>(m2.columns());
+    size_t const            inner = static_cast<size_t>(m1.columns());
+    size_t const            rank  = e1.rank();
+    T1 const* const         p_u   = e1.left_factor_data();
+    T1 const* const         p_v   = e1.right_factor_data();
+
+    result_type             mr;
+    std::vector<acc_type>   vtm(rank * cols);
+
+    if constexpr (result_requires_resize(mr))
+    {
+        mr.resize(rows, cols);
+    }
+
+    detail::parallel_for(0, rank, rank * inner * cols, [&](size_t first, size_t last)
+    {
+        for (size_t j = 0;  j < inner;  ++j)
+        {
+            T1 const* const     p_r = p_v + j*rank;
+            size_type_2 const   j2  = static_cast<size_type_2>(j);
+
+            for (size_t p = first;  p < last;  ++p)
+            {
+                auto const      v1    = p_r[p];
+                acc_type*       p_out = vtm.data() + p*cols;
+                size_type_2     c2;
+                size_type_r     c;
+
+                for (c = 0, c2 = 0;  c < cols;  ++c, ++c2)
+                {
+                    p_out[c] += v1 * m2(j2, c2);
+                }
+            }
+        }
+    });
+
+    detail::parallel_for(0, rows, rows * rank * cols, [&](size_t first, size_t last)
+    {
+        std::vector<acc_type>   row(cols);
+
+        for (size_type_r ir = first;  ir < last;  ++ir)
+        {
+            T1 const* const     p_r = p_u + ir*rank;
+
+            fill(row.begin(), row.end(), acc_type{});
+            for (size_t p = 0;  p < rank;  ++p)
+            {
+                auto const              u1   = p_r[p];
+                acc_type const* const   p_in = vtm.data() + p*cols;
+
+                for (size_type_r jr = 0;  jr < cols;  ++jr)
+                {
+                    row[jr] += u1 * p_in[jr];
+                }
+            }
+            for (size_type_r jr = 0;  jr < cols;  ++jr)
+            {
+                mr(ir, jr) = static_cast<elem_type_r>(row[jr]);
+            }
+        }
+    });
+
+    return mr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- low_rank_matrix*low_rank_matrix.  With C = V1.t() * U2, the product (U1 * V1.t()) * (U2 * V2.t())
+//  is (U1 * C) * V2.t() or U1 * (V2 * C.t()).t(), whichever has the smaller rank; the result stays
+//  in factored form.
+//
+template<class OTR, class T1, class A1, class OT1, class T2, class A2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR,
+                             matrix<low_rank_engine<T1, A1>, OT1>,
+                             matrix<low_rank_engine<T2, A2>, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<engine_type_2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (lr*lr)", m1, m2);
+
+    using elem_type_r = typename engine_type::value_type;
+    using acc_type    = detail::accumulator_t<elem_type_r>;
+
+    engine_type_1 const&    e1    = m1.engine();
+    engine_type_2 const&    e2    = m2.engine();
+    size_t const            rows  = static_cast<size_t>(m1.rows());
+    size_t const            cols  = static_cast<size_t>(m2.columns());
+    size_t const            inner = static_cast<size_t>(m1.columns());
+    size_t const            k1    = e1.rank();
+    size_t const            k2    = e2.rank();
+    T1 const* const         p_u1  = e1.left_factor_data();
+    T1 const* const         p_v1  = e1.right_factor_data();
+    T2 const* const         p_u2  = e2.left_factor_data();
+    T2 const* const         p_v2  = e2.right_factor_data();
+
+    std::vector<acc_type>   core(k1 * k2);
+
+    for (size_t j = 0;  j < inner;  ++j)
+    {
+        for (size_t p = 0;  p < k1;  ++p)
+        {
+            auto const      v1 = p_v1[j*k1 + p];
+
+            for (size_t q = 0;  q < k2;  ++q)
+            {
+                core[p*k2 + q] += v1 * p_u2[j*k2 + q];
+            }
+        }
+    }
+
+    if (k2 <= k1)
+    {
+        engine_type     er(rows, cols, k2);
+
+        detail::parallel_for(0, rows, rows * k1 * k2, [&](size_t first, size_t last)
+        {
+            for (size_t i = first;  i < last;  ++i)
+            {
+                for (size_t q = 0;  q < k2;  ++q)
+                {
+                    acc_type    elem{};
+
+                    for (size_t p = 0;  p < k1;  ++p)
+                    {
+                        elem += p_u1[i*k1 + p] * core[p*k2 + q];
+                    }
+                    er.left_factor(i, q) = static_cast<elem_type_r>(elem);
+                }
+            }
+        });
+        copy(p_v2, p_v2 + cols*k2, er.right_factor_data());
+
+        return result_type(std::move(er));
+    }
+    else
+    {
+        engine_type     er(rows, cols, k1);
+
+        copy(p_u1, p_u1 + rows*k1, er.left_factor_data());
+        detail::parallel_for(0, cols, cols * k1 * k2, [&](size_t first, size_t last)
+        {
+            for (size_t j = first;  j < last;  ++j)
+            {
+                for (size_t p = 0;  p < k1;  ++p)
+                {
+                    acc_type    elem{};
+
+                    for (size_t q = 0;  q < k2;  ++q)
+                    {
+                        elem += p_v2[j*k2 + q] * core[p*k2 + q];
+                    }
+                    er.right_factor(j, p) = static_cast<elem_type_r>(elem);
+                }
+            }
+        });
+
+        return result_type(std::move(er));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+//- toeplitz_matrix*vector.  The m x n Toeplitz matrix is embedded in a circulant matrix whose
+//  size is a power of two no less than m + n - 1, and the product is computed as a circular
+//  convolution by means of the FFT, requiring O((m + n) log(m + n)) operations.  Small products
+//  are computed directly.
+//
+template<class OTR, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<toeplitz_engine<T1, A1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (toeplitz*v)", m1, v2);
+
+    using elem_type_r = typename result_type::element_type;
+    using fft_type    = complex<detail::fft_real_t<elem_type_r>>;
+
+    size_type_r const   rows  = static_cast<size_type_r>(m1.rows());
+    size_t const        cols  = static_cast<size_t>(m1.columns());
+    T1 const* const     p_toe = m1.engine().toeplitz_data();
+
+    result_type     vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(rows);
+    }
+
+    if (rows * cols <= detail::fft_min_work)
+    {
+        for (size_type_r ir = 0;  ir < rows;  ++ir)
+        {
+            T1 const* const     p_row = p_toe + (rows - 1 - ir);
+            elem_type_r         er{};
+
+            for (size_t j = 0;  j < cols;  ++j)
+            {
+                er += p_row[j] * v2(static_cast<size_type_2>(j));
+            }
+            vr(ir) = er;
+        }
+    }
+    else
+    {
+        size_t const            len = detail::fft_length(rows + cols - 1);
+        std::vector<fft_type>   col(len), vec(len);
+
+        for (size_t k = 0;  k < rows;  ++k)
+        {
+            col[k] = static_cast<fft_type>(p_toe[rows - 1 - k]);
+        }
+        for (size_t j = 1;  j < cols;  ++j)
+        {
+            col[len - j] = static_cast<fft_type>(p_toe[rows - 1 + j]);
+        }
+        for (size_t j = 0;  j < cols;  ++j)
+        {
+            vec[j] = static_cast<fft_type>(v2(static_cast<size_type_2>(j)));
+        }
+
+        detail::fft_convolve(vec, col);
+
+        for (size_type_r ir = 0;  ir < rows;  ++ir)
+        {
+            vr(ir) = detail::from_fft_value<elem_type_r>(vec[ir]);
+        }
+    }
+
+    return vr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- circulant_matrix*vector.  The product is the circular convolution of the first column with the
+//  vector, computed by means of the FFT in O(n log n) operations.  Small products are computed
+//  directly.
+//
+template<class OTR, class T1, class A1, class OT1, class ET2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR, matrix<circulant_engine<T1, A1>, OT1>, vector<ET2, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, vector<ET2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (circulant*v)", m1, v2);
+
+    using elem_type_r = typename result_type::element_type;
+    using fft_type    = complex<detail::fft_real_t<elem_type_r>>;
+
+    size_type_r const   elems = static_cast<size_type_r>(m1.rows());
+    T1 const* const     p_col = m1.engine().circulant_data();
+
+    result_type     vr;
+
+    if constexpr (result_requires_resize(vr))
+    {
+        vr.resize(elems);
+    }
+
+    if (elems * elems <= detail::fft_min_work)
+    {
+        for (size_type_r ir = 0;  ir < elems;  ++ir)
+        {
+            elem_type_r     er{};
+
+            for (size_t j = 0;  j < elems;  ++j)
+            {
+                er += p_col[(ir >= j) ? ir - j : ir + elems - j] * v2(static_cast<size_type_2>(j));
+            }
+            vr(ir) = er;
+        }
+    }
+    else
+    {
+        std::vector<fft_type>   col(elems), vec(elems);
+
+        for (size_t k = 0;  k < elems;  ++k)
+        {
+            col[k] = static_cast<fft_type>(p_col[k]);
+            vec[k] = static_cast<fft_type>(v2(static_cast<size_type_2>(k)));
+        }
+
+        detail::fft_convolve(vec, col);
+
+        for (size_type_r ir = 0;  ir < elems;  ++ir)
+        {
+            vr(ir) = detail::from_fft_value<elem_type_r>(vec[ir]);
+        }
+    }
+
+    return vr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- tiled_matrix*tiled_matrix.  Each tile of the result is accumulated from the products of
+//  whole tiles of the operands, so that the inner loops run over contiguous memory; the tiles of
+//  the result are divided among the tasks.  The zero padding of the edge tiles contributes
+//  nothing to the result.
+//
+template<class OTR, class T1, size_t B, class A1, class LT1, class OT1, class T2, class A2, class LT2, class OT2>
+inline auto
+matrix_multiplication_traits<OTR,
+                             matrix<tiled_matrix_engine<T1, B, A1, LT1>, OT1>,
+                             matrix<tiled_matrix_engine<T2, B, A2, LT2>, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<engine_type_2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (tiled*tiled)", m1, m2);
+
+    if (m1.columns() != m2.rows())
+    {
+        throw runtime_error("invalid size");
+    }
+
+    engine_type_1 const&    e1      = m1.engine();
+    engine_type_2 const&    e2      = m2.engine();
+    engine_type             er(e1.rows(), e2.columns());
+    size_t const            t_rows  = er.tile_rows();
+    size_t const            t_cols  = er.tile_columns();
+    size_t const            t_inner = e1.tile_columns();
+
+    detail::parallel_for(0, t_rows * t_cols, e1.rows() * e1.columns() * e2.columns(),
+                         [&](size_t first, size_t last)
+    {
+        for (size_t t = first;  t < last;  ++t)
+        {
+            auto* const     p_r = er.tile_data(t / t_cols, t % t_cols);
+
+            for (size_t tk = 0;  tk < t_inner;  ++tk)
+            {
+                T1 const* const     p_1 = e1.tile_data(t / t_cols, tk);
+                T2 const* const     p_2 = e2.tile_data(tk, t % t_cols);
+
+                for (size_t i = 0;  i < B;  ++i)
+                {
+                    for (size_t k = 0;  k < B;  ++k)
+                    {
+                        auto const      a1 = p_1[i*B + k];
+
+                        for (size_t j = 0;  j < B;  ++j)
+                        {
+                            p_r[i*B + j] += a1 * p_2[k*B + j];
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+    return result_type(std::move(er));
+}
+
+//--------------------------------------------------------------------------------------------------
+//- fs_padded_matrix*fs_padded_vector.  Each element of the result is the dot product of a padded
+//  row with the padded vector, taken over whole lanes; the padding of both operands is zero and
+//  contributes nothing.
+//
+template<class OTR, class T1, size_t R1, size_t C1, size_t A1, class OT1, class T2, size_t A2, class OT2>
+constexpr auto
+matrix_multiplication_traits<OTR,
+                             matrix<fs_padded_matrix_engine<T1, R1, C1, A1>, OT1>,
+                             vector<fs_padded_vector_engine<T2, C1, A2>, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, vector<engine_type_2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (padded*padded)", m1, v2);
+
+    using elem_type_r = typename result_type::element_type;
+
+    constexpr size_t    P1 = engine_type_1::padded_columns;
+
+    T1 const* const     p_1 = m1.engine().data();
+    T2 const* const     p_2 = v2.engine().data();
+    result_type         vr;
+
+    for (size_t i = 0;  i < R1;  ++i)
+    {
+        elem_type_r     er{};
+
+        for (size_t k = 0;  k < P1;  ++k)
+        {
+            er += p_1[i*P1 + k] * p_2[k];
+        }
+        vr(i) = er;
+    }
+
+    return vr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- fs_padded_matrix*fs_padded_matrix.  Each padded row of the result accumulates multiples of the
+//  padded rows of the right-hand operand, over whole lanes.  The padding of the result is reset
+//  afterward, since a non-finite element of the left-hand operand times a zero padding element
+//  is not zero.
+//
+template<class OTR, class T1, size_t R1, size_t C1, size_t A1, class OT1,
+         class T2, size_t C2, size_t A2, class OT2>
+constexpr auto
+matrix_multiplication_traits<OTR,
+                             matrix<fs_padded_matrix_engine<T1, R1, C1, A1>, OT1>,
+                             matrix<fs_padded_matrix_engine<T2, C1, C2, A2>, OT2>>::multiply
+(matrix<engine_type_1, OT1> const& m1, matrix<engine_type_2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("multiplication_traits (padded*padded)", m1, m2);
+
+    using elem_type_r = typename result_type::element_type;
+
+    constexpr size_t    P1 = engine_type_1::padded_columns;
+    constexpr size_t    P2 = engine_type_2::padded_columns;
+
+    T1 const* const     p_1 = m1.engine().data();
+    T2 const* const     p_2 = m2.engine().data();
+    result_type         mr;
+    elem_type_r* const  p_r = mr.engine().data();
+
+    for (size_t i = 0;  i < R1;  ++i)
+    {
+        elem_type_r* const  p_ri = p_r + i*P2;
+
+        for (size_t k = 0;  k < C1;  ++k)
+        {
+            auto const  a1 = p_1[i*P1 + k];
+
+            for (size_t j = 0;  j < P2;  ++j)
+            {
+                p_ri[j] += a1 * p_2[k*P2 + j];
+            }
+        }
+        for (size_t j = C2;  j < P2;  ++j)
+        {
+            p_ri[j] = elem_type_r{};
+        }
+    }
+
+    return mr;
+}
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_MULTIPLICATION_TRAITS_IMPL_HPP_DEFINED
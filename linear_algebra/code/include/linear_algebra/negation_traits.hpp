@@ -384,6 +384,35 @@ struct matrix_negation_engine_traits<OT, transpose_engine<dr_matrix_engine<T1, A
     using engine_type  = dr_matrix_engine<T1, A1>;
 };
 
+//--------------------------------------------------------------------------------------------------
+//  -ENGINE cases for padded fixed-size engines.
+//
+//- fs_padded_vector_engine.
+//
+template<class OT, class T1, size_t N1, size_t A1>
+struct matrix_negation_engine_traits<OT, fs_padded_vector_engine<T1, N1, A1>>
+{
+    using element_type = matrix_negation_element_t<OT, T1>;
+    using engine_type  = fs_padded_vector_engine<element_type, N1, A1>;
+};
+
+//--------------------------
+//- fs_padded_matrix_engine.
+//
+template<class OT, class T1, size_t R1, size_t C1, size_t A1>
+struct matrix_negation_engine_traits<OT, fs_padded_matrix_engine<T1, R1, C1, A1>>
+{
+    using element_type = matrix_negation_element_t<OT, T1>;
+    using engine_type  = fs_padded_matrix_engine<element_type, R1, C1, A1>;
+};
+
+template<class OT, class T1, size_t R1, size_t C1, size_t A1, class MCT1>
+struct matrix_negation_engine_traits<OT, transpose_engine<fs_padded_matrix_engine<T1, R1, C1, A1>, MCT1>>
+{
+    using element_type = matrix_negation_element_t<OT, T1>;
+    using engine_type  = fs_padded_matrix_engine<element_type, C1, R1, A1>;
+};
+
 
 //==================================================================================================
 //                               **** NEGATION ARITHMETIC TRAITS ****
@@ -408,7 +437,7 @@ struct matrix_negation_traits<OT, vector<ET1, OT1>>
     using size_type_1 = typename vector<ET1, OT1>::size_type;
     using size_type_r = typename result_type::size_type;
 
-    static result_type  negate(vector<ET1, OT1> const& v1);
+    static constexpr result_type  negate(vector<ET1, OT1> const& v1);
 };
 
 //------
@@ -423,7 +452,7 @@ struct matrix_negation_traits<OT, matrix<ET1, OT1>>
     using size_type_1 = typename matrix<ET1, OT1>::size_type;
     using size_type_r = typename result_type::size_type;
 
-    static result_type  negate(matrix<ET1, OT1> const& m1);
+    static constexpr result_type  negate(matrix<ET1, OT1> const& m1);
 };
 
 }       //- STD_LA namespace
@@ -14,7 +14,7 @@ namespace STD_LA {
 //==================================================================================================
 //
 template<class OT, class ET1, class OT1>
-inline auto
+constexpr auto
 matrix_negation_traits<OT, vector<ET1, OT1>>::negate(vector<ET1, OT1> const& v1) -> result_type
 {
     PrintOperandTypes<result_type>("negation_traits", v1);
@@ -22,8 +22,8 @@ matrix_negation_traits<OT, vector<ET1, OT1>>::negate(vector<ET1, OT1> const& v1)
     size_type_r const   elems = static_cast<size_type_r>(v1.elements());
 
     result_type     vr;
-    size_type_r     ir;
-    size_type_1     i1;
+    size_type_r     ir = 0;
+    size_type_1     i1 = 0;
 
     if constexpr (result_requires_resize(vr))
     {
@@ -41,15 +41,15 @@ matrix_negation_traits<OT, vector<ET1, OT1>>::negate(vector<ET1, OT1> const& v1)
 //------
 //
 template<class OT, class ET1, class OT1>
-inline auto
+constexpr auto
 matrix_negation_traits<OT, matrix<ET1, OT1>>::negate(matrix<ET1, OT1> const& m1) -> result_type
 {
     size_type_r const  rows = static_cast<size_type_r>(m1.rows());
     size_type_r const  cols = static_cast<size_type_r>(m1.columns());
 
     result_type		mr;
-    size_type_r     ir, jr;
-    size_type_1     i1, j1;
+    size_type_r     ir = 0, jr = 0;
+    size_type_1     i1 = 0, j1 = 0;
 
     if constexpr (result_requires_resize(mr))
     {
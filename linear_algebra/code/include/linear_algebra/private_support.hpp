@@ -32,6 +32,127 @@ template<class T>  constexpr
 bool    is_complex_v = is_complex<T>::value;
 
 
+//==================================================================================================
+//- Traits types to detect if an engine type is a diagonal_engine<T, AT>, an identity_engine<T>, or
+//  a low_rank_engine<T, AT>.
+//==================================================================================================
+//
+template<class ET>
+struct is_diagonal_engine : public false_type
+{};
+
+template<class T, class AT>
+struct is_diagonal_engine<diagonal_engine<T, AT>> : public true_type
+{};
+
+template<class ET>  constexpr
+bool    is_diagonal_engine_v = is_diagonal_engine<ET>::value;
+
+template<class ET>
+struct is_identity_engine : public false_type
+{};
+
+template<class T>
+struct is_identity_engine<identity_engine<T>> : public true_type
+{};
+
+template<class ET>  constexpr
+bool    is_identity_engine_v = is_identity_engine<ET>::value;
+
+template<class ET>
+struct is_low_rank_engine : public false_type
+{};
+
+template<class T, class AT>
+struct is_low_rank_engine<low_rank_engine<T, AT>> : public true_type
+{};
+
+template<class ET>  constexpr
+bool    is_low_rank_engine_v = is_low_rank_engine<ET>::value;
+
+
+//==================================================================================================
+//- Traits type to detect if an engine type is a non-owning view of some other engine or of external
+//  memory, and so may refer to the elements of the engine to which it is being assigned.
+//==================================================================================================
+//
+template<class ET>
+struct is_view_engine : public false_type
+{};
+
+template<class ET, class VCT>
+struct is_view_engine<column_engine<ET, VCT>> : public true_type
+{};
+
+template<class ET, class VCT>
+struct is_view_engine<row_engine<ET, VCT>> : public true_type
+{};
+
+template<class ET, class MCT>
+struct is_view_engine<transpose_engine<ET, MCT>> : public true_type
+{};
+
+template<class ET, class MCT>
+struct is_view_engine<submatrix_engine<ET, MCT>> : public true_type
+{};
+
+template<class ET, class TT, class DT>
+struct is_view_engine<triangular_engine<ET, TT, DT>> : public true_type
+{};
+
+template<class T>
+struct is_view_engine<span_vector_engine<T>> : public true_type
+{};
+
+template<class T>
+struct is_view_engine<span_matrix_engine<T>> : public true_type
+{};
+
+template<class ET>  constexpr
+bool    is_view_engine_v = is_view_engine<ET>::value;
+
+
+//==================================================================================================
+//- Traits type to detect if an engine type owns its elements and stores them densely by rows, so
+//  that element (i, j) lies at offset i*column_capacity() + j from the address of element (0, 0).
+//==================================================================================================
+//
+template<class ET>
+struct is_dense_owning_engine : public false_type
+{};
+
+template<class T, class AT>
+struct is_dense_owning_engine<dr_vector_engine<T, AT>> : public true_type
+{};
+
+template<class T, class AT>
+struct is_dense_owning_engine<dr_matrix_engine<T, AT>> : public true_type
+{};
+
+template<class T, class AT>
+struct is_dense_owning_engine<cow_matrix_engine<T, AT>> : public true_type
+{};
+
+template<class T, size_t N>
+struct is_dense_owning_engine<fs_vector_engine<T, N>> : public true_type
+{};
+
+template<class T, size_t R, size_t C>
+struct is_dense_owning_engine<fs_matrix_engine<T, R, C>> : public true_type
+{};
+
+template<class T, size_t N, size_t A>
+struct is_dense_owning_engine<fs_padded_vector_engine<T, N, A>> : public true_type
+{};
+
+template<class T, size_t R, size_t C, size_t A>
+struct is_dense_owning_engine<fs_padded_matrix_engine<T, R, C, A>> : public true_type
+{};
+
+template<class ET>  constexpr
+bool    is_dense_owning_engine_v = is_dense_owning_engine<ET>::value;
+
+
 //==================================================================================================
 //  Traits type that specifies important properties of an engine, based on its tag.
 //==================================================================================================
@@ -409,12 +530,552 @@ deallocate(AT& alloc, typename allocator_traits<AT>::pointer p_dst, size_t n) no
     }
 }
 
+//- Transfers n elements from one buffer returned by allocate() to another when an engine
+//  reallocates.  Since both buffers hold constructed elements, this is done by move-assignment,
+//  or by a single memcpy when the element type is trivially copyable.
+//
+template<class PT>
+void
+relocate_n(PT p_src, size_t n, PT p_dst)
+{
+    using elem_type = typename pointer_traits<PT>::element_type;
+
+    if constexpr (is_trivially_copyable_v<elem_type>)
+    {
+        if (n != 0)
+        {
+            memcpy(addressof(*p_dst), addressof(*p_src), n * sizeof(elem_type));
+        }
+    }
+    else
+    {
+        move(p_src, p_src + n, p_dst);
+    }
+}
+
+//- Computes the capacity to be allocated when an engine must grow to hold at least 'needed'
+//  elements (or rows).  Capacity grows geometrically so that a sequence of appends costs
+//  amortized constant time per element.  An engine with no storage yet receives exactly what
+//  it needs, so that freshly sized results (e.g., of arithmetic) carry no spare capacity.
+//
+inline constexpr size_t
+grow_capacity(size_t current, size_t needed) noexcept
+{
+    return (current == 0) ? needed : max(current + current / 2, needed);
+}
+
 //- Alias template used for convenience when rebinding allocators.
 //
 template<class A1, class T1>
 using rebind_alloc_t = typename allocator_traits<A1>::template rebind_alloc<T1>;
 
 
+//==================================================================================================
+//- Function to detect if it is being called during constant evaluation, so that the arithmetic
+//  traits can skip their diagnostic output and pointer-based kernels when evaluated at compile
+//  time.  This is std::is_constant_evaluated() where available and the equivalent compiler
+//  built-in otherwise; without either, it always returns false.
+//==================================================================================================
+//
+constexpr bool
+is_constant_evaluated() noexcept
+{
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(__clang__) && __clang_major__ >= 9) || \
+      (defined(_MSC_VER) && _MSC_VER >= 1925)
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+
+//==================================================================================================
+//- Function that computes the number of elements stored for each row of a padded fixed-size
+//  engine, which is the number of columns rounded up to a multiple of four lanes.
+//==================================================================================================
+//
+constexpr size_t
+padded_extent(size_t n) noexcept
+{
+    return (n + 3u) & ~size_t(3u);
+}
+
+
+//==================================================================================================
+//- Traits type that gives the type in which the arithmetic kernels accumulate sums of products of
+//  elements of type T before storing them.  It is T itself, except for the reduced-precision
+//  element types, which are accumulated in float and rounded once on storing.
+//==================================================================================================
+//
+template<class T>
+struct accumulator_type
+{
+    using type = T;
+};
+
+template<class T>
+using accumulator_t = typename accumulator_type<T>::type;
+
+
+//==================================================================================================
+//  Some private helpers for running the multithreaded arithmetic kernels.  Work is split across
+//  a small number of std::thread objects only when there is enough of it to amortize the cost of
+//  starting them; otherwise the kernel simply runs on the calling thread.  The upper bound on
+//  the number of threads can be set at compile time with LA_MAX_THREADS.
+//==================================================================================================
+//
+inline constexpr size_t     min_task_work = 1u << 15;   //- Minimum multiply-adds per thread
+
+inline size_t
+max_worker_threads() noexcept
+{
+#ifdef LA_MAX_THREADS
+    return (LA_MAX_THREADS > 0) ? (size_t) LA_MAX_THREADS : 1u;
+#else
+    static size_t const     n = max<size_t>(1u, thread::hardware_concurrency());
+    return n;
+#endif
+}
+
+//- Runs fn(t) for each t in [0, tasks), with task 0 running on the calling thread.  The first
+//  exception thrown by any task is re-thrown after all of the tasks have finished.
+//
+template<class FN>
+void
+parallel_tasks(size_t tasks, FN const& fn)
+{
+    if (tasks <= 1)
+    {
+        if (tasks == 1) fn(size_t(0));
+        return;
+    }
+
+    std::vector<thread>     workers;
+    exception_ptr           p_exc;
+    mutex                   exc_mutex;
+    size_t                  t = 1;
+
+    auto    run = [&fn, &p_exc, &exc_mutex](size_t task)
+    {
+        try
+        {
+            fn(task);
+        }
+        catch (...)
+        {
+            lock_guard<mutex>   lock(exc_mutex);
+            if (!p_exc) p_exc = current_exception();
+        }
+    };
+
+    try
+    {
+        workers.reserve(tasks - 1);
+        for (;  t < tasks;  ++t)
+        {
+            workers.emplace_back(run, t);
+        }
+    }
+    catch (...)
+    {}                      //- Could not start another thread, so run the remainder here.
+
+    for (size_t r = t;  r < tasks;  ++r)
+    {
+        run(r);
+    }
+    run(0);
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    if (p_exc) rethrow_exception(p_exc);
+}
+
+//- Returns the number of tasks into which a loop over n items requiring an estimated total of
+//  'work' multiply-adds should be split.
+//
+inline size_t
+task_count(size_t n, size_t work) noexcept
+{
+    size_t const    tasks = min(work / min_task_work, max_worker_threads());
+    return max<size_t>(1u, min(tasks, n));
+}
+
+//- Calls fn(first_i, last_i) over disjoint sub-ranges that exactly cover [first, last).
+//
+template<class FN>
+void
+parallel_for(size_t first, size_t last, size_t work, FN const& fn)
+{
+    if (last <= first) return;
+
+    size_t const    n     = last - first;
+    size_t const    tasks = task_count(n, work);
+
+    parallel_tasks(tasks, [first, n, tasks, &fn](size_t t)
+    {
+        fn(first + (n * t) / tasks, first + (n * (t + 1)) / tasks);
+    });
+}
+
+//- Calls fn(first_i, last_i) over disjoint sub-ranges that exactly cover [0, n), where the cost of
+//  item i is proportional to i + 1 (as for the rows of a lower triangle).  The sub-ranges are
+//  chosen so that each covers roughly the same share of the triangle.
+//
+template<class FN>
+void
+parallel_for_triangle(size_t n, size_t work, FN const& fn)
+{
+    if (n == 0) return;
+
+    size_t const    tasks = task_count(n, work);
+
+    auto    bound = [n, tasks](size_t t) -> size_t
+    {
+        return (t == tasks) ? n : static_cast<size_t>(n * sqrt(double(t) / double(tasks)));
+    };
+
+    parallel_tasks(tasks, [&bound, &fn](size_t t)
+    {
+        size_t const    first = bound(t);
+        size_t const    last  = bound(t + 1);
+
+        if (first < last) fn(first, last);
+    });
+}
+
+
+//==================================================================================================
+//  Some private helpers for bulk copying between engines whose elements are stored contiguously
+//  by rows.  Identical trivially-copyable element types are copied with memcpy; otherwise each
+//  element is converted by a simple unit-stride loop, which compilers vectorize for conversions
+//  between the arithmetic types.  Large copies are split across threads, since a single core
+//  cannot saturate the memory bandwidth of most machines.
+//==================================================================================================
+//
+inline constexpr size_t     min_copy_work_shift = 4;    //- Elements copied per multiply-add
+
+template<class T1, class T2>
+void
+copy_elements_serial(T1 const* p_src, size_t n, T2* p_dst)
+{
+    if constexpr (is_same_v<remove_cv_t<T1>, T2>  &&  is_trivially_copyable_v<T2>)
+    {
+        if (n != 0)
+        {
+            memcpy(p_dst, p_src, n * sizeof(T2));
+        }
+    }
+    else
+    {
+        for (size_t i = 0;  i < n;  ++i)
+        {
+            p_dst[i] = static_cast<T2>(p_src[i]);
+        }
+    }
+}
+
+//- Copies n contiguous elements, converting each to the destination type.
+//
+template<class T1, class T2>
+void
+copy_elements(T1 const* p_src, size_t n, T2* p_dst)
+{
+    parallel_for(0, n, n >> min_copy_work_shift, [p_src, p_dst](size_t first, size_t last)
+    {
+        copy_elements_serial(p_src + first, last - first, p_dst + first);
+    });
+}
+
+//- Copies a rows x cols block of elements between buffers whose rows begin 'src_stride' and
+//  'dst_stride' elements apart.  When both blocks are contiguous the copy is done in one piece;
+//  otherwise it proceeds a row at a time.
+//
+template<class T1, class T2>
+void
+copy_rows(T1 const* p_src, size_t src_stride, T2* p_dst, size_t dst_stride, size_t rows, size_t cols)
+{
+    if (src_stride == cols  &&  dst_stride == cols)
+    {
+        copy_elements(p_src, rows * cols, p_dst);
+    }
+    else
+    {
+        parallel_for(0, rows, (rows * cols) >> min_copy_work_shift,
+                     [=](size_t first, size_t last)
+                     {
+                         for (size_t i = first;  i < last;  ++i)
+                         {
+                             copy_elements_serial(p_src + i*src_stride, cols, p_dst + i*dst_stride);
+                         }
+                     });
+    }
+}
+
+
+//==================================================================================================
+//  Traits type to detect if an engine exposes the layout of its elements through data(), which
+//  returns the address of element zero, and stride(), which returns the distance in elements
+//  between consecutive elements (for vector engines) or a tuple holding the distances between
+//  consecutive rows and columns (for matrix engines).
+//==================================================================================================
+//
+template<class ET, class = void>
+struct has_strided_layout : public false_type
+{};
+
+template<class ET>
+struct has_strided_layout<ET, void_t<decltype(declval<ET const&>().data()),
+                                     decltype(declval<ET const&>().stride())>>
+:   public true_type
+{};
+
+template<class ET>  constexpr
+bool    has_strided_layout_v = has_strided_layout<ET>::value;
+
+//- Alias template used by the view engines to expose a strided layout via SFINAE, but only when
+//  the engine to which they refer does so itself.
+//
+template<class ET1, class ET2>
+using enable_if_strided = enable_if_t<is_same_v<ET1, ET2> && has_strided_layout_v<ET2>, bool>;
+
+
+//==================================================================================================
+//  Some private kernels for products of operands whose elements are addressed through pointers
+//  and strides.  The result is always stored densely by rows, with rows c_rs elements apart.
+//==================================================================================================
+//
+inline constexpr size_t     gemm_inner_block = 128;     //- Rows of B reused per pass over C
+inline constexpr size_t     gemm_col_block   = 512;     //- Columns of C updated per pass
+
+//- Computes the rows x cols product C = A * B, where A is rows x inner and B is inner x cols.
+//  When the rows of B are contiguous, each row of C is accumulated as a sum of scaled rows of B
+//  over blocks of B small enough to remain in cache; otherwise each element of C is computed as
+//  a dot product.  When TR is accumulated in a wider type, the rows of C are accumulated in a
+//  per-thread buffer of that type, one block of columns at a time; the elements of A and B are
+//  converted as they are loaded, and each element of C is converted once as it is stored.
+//
+template<class T1, class T2, class TR>
+void
+strided_gemm(size_t rows, size_t cols, size_t inner,
+             T1 const* p_a, ptrdiff_t a_rs, ptrdiff_t a_cs,
+             T2 const* p_b, ptrdiff_t b_rs, ptrdiff_t b_cs,
+             TR* p_c, ptrdiff_t c_rs)
+{
+    using acc_type = accumulator_t<TR>;
+
+    parallel_for(0, rows, rows * cols * inner, [=](size_t first, size_t last)
+    {
+        if constexpr (!is_same_v<acc_type, TR>)
+        {
+            if (b_cs == 1)
+            {
+                size_t const            acc_cols = min(cols, gemm_col_block);
+                std::vector<acc_type>   acc((last - first) * acc_cols);
+
+                for (size_t jj = 0;  jj < cols;  jj += gemm_col_block)
+                {
+                    size_t const    j_len = min(cols, jj + gemm_col_block) - jj;
+
+                    fill(acc.begin(), acc.end(), acc_type{});
+
+                    for (size_t kk = 0;  kk < inner;  kk += gemm_inner_block)
+                    {
+                        size_t const    k_end = min(inner, kk + gemm_inner_block);
+
+                        for (size_t i = first;  i < last;  ++i)
+                        {
+                            acc_type* const     p_acc = acc.data() + (i - first)*acc_cols;
+                            T1 const* const     p_ai  = p_a + (ptrdiff_t) i*a_rs;
+
+                            for (size_t k = kk;  k < k_end;  ++k)
+                            {
+                                acc_type const      a_ik = p_ai[(ptrdiff_t) k*a_cs];
+                                T2 const* const     p_bk = p_b + (ptrdiff_t) k*b_rs + jj;
+
+                                for (size_t j = 0;  j < j_len;  ++j)
+                                {
+                                    p_acc[j] += a_ik * static_cast<acc_type>(p_bk[j]);
+                                }
+                            }
+                        }
+                    }
+
+                    for (size_t i = first;  i < last;  ++i)
+                    {
+                        acc_type const* const   p_acc = acc.data() + (i - first)*acc_cols;
+                        TR* const               p_ci  = p_c + (ptrdiff_t) i*c_rs + jj;
+
+                        for (size_t j = 0;  j < j_len;  ++j)
+                        {
+                            p_ci[j] = static_cast<TR>(p_acc[j]);
+                        }
+                    }
+                }
+                return;
+            }
+        }
+
+        if (b_cs == 1)
+        {
+            for (size_t i = first;  i < last;  ++i)
+            {
+                fill_n(p_c + (ptrdiff_t) i*c_rs, cols, TR{});
+            }
+
+            for (size_t kk = 0;  kk < inner;  kk += gemm_inner_block)
+            {
+                size_t const    k_end = min(inner, kk + gemm_inner_block);
+
+                for (size_t jj = 0;  jj < cols;  jj += gemm_col_block)
+                {
+                    size_t const    j_len = min(cols, jj + gemm_col_block) - jj;
+
+                    for (size_t i = first;  i < last;  ++i)
+                    {
+                        TR* const           p_ci = p_c + (ptrdiff_t) i*c_rs + jj;
+                        T1 const* const     p_ai = p_a + (ptrdiff_t) i*a_rs;
+
+                        for (size_t k = kk;  k < k_end;  ++k)
+                        {
+                            T1 const            a_ik = p_ai[(ptrdiff_t) k*a_cs];
+                            T2 const* const     p_bk = p_b + (ptrdiff_t) k*b_rs + jj;
+
+                            for (size_t j = 0;  j < j_len;  ++j)
+                            {
+                                p_ci[j] += a_ik * p_bk[j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (size_t i = first;  i < last;  ++i)
+            {
+                T1 const* const     p_ai = p_a + (ptrdiff_t) i*a_rs;
+                TR* const           p_ci = p_c + (ptrdiff_t) i*c_rs;
+
+                for (size_t j = 0;  j < cols;  ++j)
+                {
+                    T2 const* const     p_bj = p_b + (ptrdiff_t) j*b_cs;
+                    acc_type            er{};
+
+                    for (size_t k = 0;  k < inner;  ++k)
+                    {
+                        er += p_ai[(ptrdiff_t) k*a_cs] * p_bj[(ptrdiff_t) k*b_rs];
+                    }
+                    p_ci[j] = static_cast<TR>(er);
+                }
+            }
+        }
+    });
+}
+
+//- Computes the product r = A * x, where A is rows x inner and r is contiguous.  Each element of
+//  r is accumulated in the accumulator type of TR and converted once as it is stored.
+//
+template<class T1, class T2, class TR>
+void
+strided_gemv(size_t rows, size_t inner,
+             T1 const* p_a, ptrdiff_t a_rs, ptrdiff_t a_cs,
+             T2 const* p_x, ptrdiff_t x_s,
+             TR* p_r)
+{
+    using acc_type = accumulator_t<TR>;
+
+    parallel_for(0, rows, rows * inner, [=](size_t first, size_t last)
+    {
+        for (size_t i = first;  i < last;  ++i)
+        {
+            T1 const* const     p_ai = p_a + (ptrdiff_t) i*a_rs;
+            acc_type            er{};
+
+            for (size_t k = 0;  k < inner;  ++k)
+            {
+                er += p_ai[(ptrdiff_t) k*a_cs] * p_x[(ptrdiff_t) k*x_s];
+            }
+            p_r[i] = static_cast<TR>(er);
+        }
+    });
+}
+
+//- Computes the update C -= A * B, where A is rows x inner and B is inner x cols with contiguous
+//  rows, as for the trailing updates of the blocked factorizations.  Groups of four rows of C are
+//  updated together, so that each element of B loaded from cache is used four times.
+//
+template<class T1, class T2, class TR>
+void
+strided_gemm_subtract(size_t rows, size_t cols, size_t inner,
+                      T1 const* p_a, ptrdiff_t a_rs, ptrdiff_t a_cs,
+                      T2 const* p_b, ptrdiff_t b_rs,
+                      TR* p_c, ptrdiff_t c_rs)
+{
+    parallel_for(0, (rows + 3) / 4, rows * cols * inner, [=](size_t first, size_t last)
+    {
+        size_t const    i_first = 4 * first;
+        size_t const    i_last  = min(rows, 4 * last);
+
+        for (size_t jj = 0;  jj < cols;  jj += gemm_col_block)
+        {
+            size_t const    j_len = min(cols, jj + gemm_col_block) - jj;
+            size_t          i     = i_first;
+
+            for (;  i + 4 <= i_last;  i += 4)
+            {
+                TR* const           p_c0 = p_c + (ptrdiff_t) i*c_rs + jj;
+                TR* const           p_c1 = p_c0 + c_rs;
+                TR* const           p_c2 = p_c1 + c_rs;
+                TR* const           p_c3 = p_c2 + c_rs;
+                T1 const* const     p_a0 = p_a + (ptrdiff_t) i*a_rs;
+
+                for (size_t k = 0;  k < inner;  ++k)
+                {
+                    T1 const* const     p_ak = p_a0 + (ptrdiff_t) k*a_cs;
+                    T1 const            a0   = p_ak[0];
+                    T1 const            a1   = p_ak[a_rs];
+                    T1 const            a2   = p_ak[2*a_rs];
+                    T1 const            a3   = p_ak[3*a_rs];
+                    T2 const* const     p_bk = p_b + (ptrdiff_t) k*b_rs + jj;
+
+                    for (size_t j = 0;  j < j_len;  ++j)
+                    {
+                        T2 const    b = p_bk[j];
+
+                        p_c0[j] -= a0 * b;
+                        p_c1[j] -= a1 * b;
+                        p_c2[j] -= a2 * b;
+                        p_c3[j] -= a3 * b;
+                    }
+                }
+            }
+
+            for (;  i < i_last;  ++i)
+            {
+                TR* const           p_ci = p_c + (ptrdiff_t) i*c_rs + jj;
+                T1 const* const     p_ai = p_a + (ptrdiff_t) i*a_rs;
+
+                for (size_t k = 0;  k < inner;  ++k)
+                {
+                    T1 const            a_ik = p_ai[(ptrdiff_t) k*a_cs];
+                    T2 const* const     p_bk = p_b + (ptrdiff_t) k*b_rs + jj;
+
+                    for (size_t j = 0;  j < j_len;  ++j)
+                    {
+                        p_ci[j] -= a_ik * p_bk[j];
+                    }
+                }
+            }
+        }
+    });
+}
+
+
 //==================================================================================================
 //- Temporary replacement for std::swap (which is constexpr in C++20)
 //==================================================================================================
@@ -0,0 +1,318 @@
+//==================================================================================================
+//  File:       reduced_precision.hpp
+//
+//  Summary:    This header defines the 16-bit floating-point element types bfloat16 and half,
+//              and the element promotion traits that keep them as the element type of the
+//              results of arithmetic on them.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_REDUCED_PRECISION_HPP_DEFINED
+#define LINEAR_ALGEBRA_REDUCED_PRECISION_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Some private helpers for reinterpreting the bits of a float.
+//==================================================================================================
+//
+inline uint32_t
+float_bits(float f) noexcept
+{
+    uint32_t    u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+inline float
+bits_float(uint32_t u) noexcept
+{
+    float   f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+}       //- detail namespace
+
+//==================================================================================================
+//  The bfloat16 type holds the upper 16 bits of a float (a sign bit, 8 exponent bits, and 7
+//  significand bits), so it has the range of float with about three significant decimal digits.
+//  Values convert implicitly to and from float, and all arithmetic on them is carried out in
+//  float; conversion from float rounds to the nearest representable value, ties to even.
+//==================================================================================================
+//
+class bfloat16
+{
+  public:
+    constexpr bfloat16() noexcept;
+    bfloat16(float f) noexcept;
+
+    operator float() const noexcept;
+
+    bfloat16&   operator +=(float rhs) noexcept;
+    bfloat16&   operator -=(float rhs) noexcept;
+    bfloat16&   operator *=(float rhs) noexcept;
+    bfloat16&   operator /=(float rhs) noexcept;
+
+    static constexpr bfloat16   from_bits(uint16_t bits) noexcept;
+    constexpr uint16_t          bits() const noexcept;
+
+  private:
+    uint16_t    m_bits;
+};
+
+inline constexpr
+bfloat16::bfloat16() noexcept
+:   m_bits(0)
+{}
+
+inline
+bfloat16::bfloat16(float f) noexcept
+:   m_bits(0)
+{
+    uint32_t    u = detail::float_bits(f);
+
+    if ((u & 0x7FFFFFFFu) > 0x7F800000u)
+    {
+        m_bits = static_cast<uint16_t>((u >> 16) | 0x0040u);        //- Keep NaNs quiet
+    }
+    else
+    {
+        u += 0x7FFFu + ((u >> 16) & 1u);
+        m_bits = static_cast<uint16_t>(u >> 16);
+    }
+}
+
+inline
+bfloat16::operator float() const noexcept
+{
+    return detail::bits_float(static_cast<uint32_t>(m_bits) << 16);
+}
+
+inline bfloat16&
+bfloat16::operator +=(float rhs) noexcept
+{
+    return *this = bfloat16(float(*this) + rhs);
+}
+
+inline bfloat16&
+bfloat16::operator -=(float rhs) noexcept
+{
+    return *this = bfloat16(float(*this) - rhs);
+}
+
+inline bfloat16&
+bfloat16::operator *=(float rhs) noexcept
+{
+    return *this = bfloat16(float(*this) * rhs);
+}
+
+inline bfloat16&
+bfloat16::operator /=(float rhs) noexcept
+{
+    return *this = bfloat16(float(*this) / rhs);
+}
+
+inline constexpr bfloat16
+bfloat16::from_bits(uint16_t bits) noexcept
+{
+    bfloat16    b;
+    b.m_bits = bits;
+    return b;
+}
+
+inline constexpr uint16_t
+bfloat16::bits() const noexcept
+{
+    return m_bits;
+}
+
+
+//==================================================================================================
+//  The half type is the IEEE 754 binary16 format (a sign bit, 5 exponent bits, and 10 significand
+//  bits), with a largest finite value of 65504.  As with bfloat16, values convert implicitly to
+//  and from float, arithmetic is carried out in float, and conversion from float rounds to the
+//  nearest representable value, ties to even; values too large to represent become infinities.
+//==================================================================================================
+//
+class half
+{
+  public:
+    constexpr half() noexcept;
+    half(float f) noexcept;
+
+    operator float() const noexcept;
+
+    half&   operator +=(float rhs) noexcept;
+    half&   operator -=(float rhs) noexcept;
+    half&   operator *=(float rhs) noexcept;
+    half&   operator /=(float rhs) noexcept;
+
+    static constexpr half   from_bits(uint16_t bits) noexcept;
+    constexpr uint16_t      bits() const noexcept;
+
+  private:
+    uint16_t    m_bits;
+};
+
+inline constexpr
+half::half() noexcept
+:   m_bits(0)
+{}
+
+inline
+half::half(float f) noexcept
+:   m_bits(0)
+{
+    uint32_t const  u    = detail::float_bits(f);
+    uint32_t const  sign = (u >> 16) & 0x8000u;
+    uint32_t        a    = u & 0x7FFFFFFFu;
+
+    if (a >= 0x47800000u)               //- Overflow, infinity, or NaN
+    {
+        m_bits = static_cast<uint16_t>(sign | ((a > 0x7F800000u) ? 0x7E00u : 0x7C00u));
+    }
+    else if (a < 0x38800000u)           //- Subnormal or zero; adding 0.5 rounds the significand
+    {
+        a = detail::float_bits(detail::bits_float(a) + 0.5f) - 0x3F000000u;
+        m_bits = static_cast<uint16_t>(sign | a);
+    }
+    else                                //- Normal; re-bias the exponent and round
+    {
+        a += 0xC8000FFFu + ((a >> 13) & 1u);
+        m_bits = static_cast<uint16_t>(sign | (a >> 13));
+    }
+}
+
+inline
+half::operator float() const noexcept
+{
+    uint32_t const  sign = static_cast<uint32_t>(m_bits & 0x8000u) << 16;
+    uint32_t const  expo = (m_bits >> 10) & 0x1Fu;
+    uint32_t const  mant = m_bits & 0x3FFu;
+
+    if (expo == 0x1Fu)
+    {
+        return detail::bits_float(sign | 0x7F800000u | (mant << 13));
+    }
+    else if (expo == 0)
+    {
+        float const     mag = static_cast<float>(mant) * 5.9604644775390625e-8f;   //- 2^-24
+        return detail::bits_float(sign | detail::float_bits(mag));
+    }
+    else
+    {
+        return detail::bits_float(sign | ((expo + 112u) << 23) | (mant << 13));
+    }
+}
+
+inline half&
+half::operator +=(float rhs) noexcept
+{
+    return *this = half(float(*this) + rhs);
+}
+
+inline half&
+half::operator -=(float rhs) noexcept
+{
+    return *this = half(float(*this) - rhs);
+}
+
+inline half&
+half::operator *=(float rhs) noexcept
+{
+    return *this = half(float(*this) * rhs);
+}
+
+inline half&
+half::operator /=(float rhs) noexcept
+{
+    return *this = half(float(*this) / rhs);
+}
+
+inline constexpr half
+half::from_bits(uint16_t bits) noexcept
+{
+    half    h;
+    h.m_bits = bits;
+    return h;
+}
+
+inline constexpr uint16_t
+half::bits() const noexcept
+{
+    return m_bits;
+}
+
+
+//==================================================================================================
+//  Element promotion traits.  Arithmetic on two bfloat16 or two half elements yields float, so
+//  these specializations make the element type of the result match that of the operands.  Sums of
+//  products are accumulated in float by the kernels (see detail::accumulator_type below), and
+//  each result is rounded once when it is stored.
+//==================================================================================================
+//
+template<>
+struct matrix_negation_element_traits<bfloat16>
+{
+    using element_type = bfloat16;
+};
+
+template<>
+struct matrix_addition_element_traits<bfloat16, bfloat16>
+{
+    using element_type = bfloat16;
+};
+
+template<>
+struct matrix_subtraction_element_traits<bfloat16, bfloat16>
+{
+    using element_type = bfloat16;
+};
+
+template<>
+struct matrix_multiplication_element_traits<bfloat16, bfloat16>
+{
+    using element_type = bfloat16;
+};
+
+template<>
+struct matrix_negation_element_traits<half>
+{
+    using element_type = half;
+};
+
+template<>
+struct matrix_addition_element_traits<half, half>
+{
+    using element_type = half;
+};
+
+template<>
+struct matrix_subtraction_element_traits<half, half>
+{
+    using element_type = half;
+};
+
+template<>
+struct matrix_multiplication_element_traits<half, half>
+{
+    using element_type = half;
+};
+
+namespace detail {
+
+template<>
+struct accumulator_type<bfloat16>
+{
+    using type = float;
+};
+
+template<>
+struct accumulator_type<half>
+{
+    using type = float;
+};
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_REDUCED_PRECISION_HPP_DEFINED
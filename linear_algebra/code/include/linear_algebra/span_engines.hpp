@@ -0,0 +1,520 @@
+//==================================================================================================
+//  File:       span_engines.hpp
+//
+//  Summary:    This header defines non-owning vector and matrix engines that refer to elements
+//              held in memory owned by someone else, described by a pointer, extents, and
+//              strides.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SPAN_ENGINES_HPP_DEFINED
+#define LINEAR_ALGEBRA_SPAN_ENGINES_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//  Span vector engine.  Element i is at offset i*stride() from data(); the stride may be any
+//  non-zero value, including a negative one.  The engine is writable, unless T is const-qualified,
+//  in which case it is readable.
+//
+//  Copying the engine copies the reference, not the elements; assigning from some other engine
+//  type copies the elements into the referenced memory, whose size cannot change.
+//==================================================================================================
+//
+template<class T>
+class span_vector_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = conditional_t<is_const_v<T>, readable_vector_engine_tag,
+                                                         writable_vector_engine_tag>;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+
+    //- Construct/copy/destroy
+    //
+    ~span_vector_engine() noexcept = default;
+
+    constexpr span_vector_engine() noexcept;
+    constexpr span_vector_engine(span_vector_engine&&) noexcept = default;
+    constexpr span_vector_engine(span_vector_engine const&) noexcept = default;
+    constexpr span_vector_engine(pointer p_elems, size_type elems) noexcept;
+    constexpr span_vector_engine(pointer p_elems, size_type elems, difference_type stride) noexcept;
+
+    constexpr span_vector_engine&   operator =(span_vector_engine&&) noexcept = default;
+    constexpr span_vector_engine&   operator =(span_vector_engine const&) noexcept = default;
+    template<class ET2>
+    constexpr span_vector_engine&   operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    constexpr size_type     capacity() const noexcept;
+    constexpr size_type     elements() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference         operator ()(size_type i);
+    constexpr const_reference   operator ()(size_type i) const;
+
+    //- Layout
+    //
+    constexpr pointer           data() const noexcept;
+    constexpr difference_type   stride() const noexcept;
+    constexpr bool              is_contiguous() const noexcept;
+
+    //- Modifiers
+    //
+    constexpr void      swap(span_vector_engine& rhs) noexcept;
+    constexpr void      swap_elements(size_type i, size_type j) noexcept;
+
+  private:
+    pointer         mp_elems;
+    size_type       m_elems;
+    difference_type m_stride;
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T> constexpr
+span_vector_engine<T>::span_vector_engine() noexcept
+:   mp_elems(nullptr)
+,   m_elems(0)
+,   m_stride(1)
+{}
+
+template<class T> constexpr
+span_vector_engine<T>::span_vector_engine(pointer p_elems, size_type elems) noexcept
+:   mp_elems(p_elems)
+,   m_elems(elems)
+,   m_stride(1)
+{}
+
+template<class T> constexpr
+span_vector_engine<T>::span_vector_engine(pointer p_elems, size_type elems, difference_type stride) noexcept
+:   mp_elems(p_elems)
+,   m_elems(elems)
+,   m_stride(stride)
+{}
+
+//- A source that is a view may refer to the elements of this engine in a different order (such
+//  as a span over the same elements with a negative stride), so it is copied to a temporary
+//  buffer before any element is written.
+//
+template<class T>
+template<class ET2> constexpr
+span_vector_engine<T>&
+span_vector_engine<T>::operator =(ET2 const& rhs)
+{
+    static_assert(is_writable_engine_v<span_vector_engine>);
+    static_assert(is_vector_engine_v<ET2>);
+    using src_size_type = typename ET2::size_type;
+
+    if ((size_type) rhs.elements() != m_elems)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    src_size_type   si;
+    size_type       di;
+
+    if constexpr (detail::is_view_engine_v<ET2>)
+    {
+        std::vector<value_type>     tmp(m_elems);
+
+        for (di = 0, si = 0;  di < m_elems;  ++di, ++si)
+        {
+            tmp[di] = static_cast<value_type>(rhs(si));
+        }
+        for (di = 0;  di < m_elems;  ++di)
+        {
+            (*this)(di) = std::move(tmp[di]);
+        }
+    }
+    else
+    {
+        for (di = 0, si = 0;  di < m_elems;  ++di, ++si)
+        {
+            (*this)(di) = static_cast<value_type>(rhs(si));
+        }
+    }
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T> constexpr
+typename span_vector_engine<T>::size_type
+span_vector_engine<T>::capacity() const noexcept
+{
+    return m_elems;
+}
+
+template<class T> constexpr
+typename span_vector_engine<T>::size_type
+span_vector_engine<T>::elements() const noexcept
+{
+    return m_elems;
+}
+
+//----------------
+//- Element access
+//
+template<class T> constexpr
+typename span_vector_engine<T>::reference
+span_vector_engine<T>::operator ()(size_type i)
+{
+    return mp_elems[(difference_type) i * m_stride];
+}
+
+template<class T> constexpr
+typename span_vector_engine<T>::const_reference
+span_vector_engine<T>::operator ()(size_type i) const
+{
+    return mp_elems[(difference_type) i * m_stride];
+}
+
+//--------
+//- Layout
+//
+template<class T> constexpr
+typename span_vector_engine<T>::pointer
+span_vector_engine<T>::data() const noexcept
+{
+    return mp_elems;
+}
+
+template<class T> constexpr
+typename span_vector_engine<T>::difference_type
+span_vector_engine<T>::stride() const noexcept
+{
+    return m_stride;
+}
+
+template<class T> constexpr
+bool
+span_vector_engine<T>::is_contiguous() const noexcept
+{
+    return m_stride == 1  ||  m_elems <= 1;
+}
+
+//-----------
+//- Modifiers
+//
+template<class T> constexpr
+void
+span_vector_engine<T>::swap(span_vector_engine& rhs) noexcept
+{
+    detail::la_swap(mp_elems, rhs.mp_elems);
+    detail::la_swap(m_elems,  rhs.m_elems);
+    detail::la_swap(m_stride, rhs.m_stride);
+}
+
+template<class T> constexpr
+void
+span_vector_engine<T>::swap_elements(size_type i, size_type j) noexcept
+{
+    detail::la_swap((*this)(i), (*this)(j));
+}
+
+
+//==================================================================================================
+//  Span matrix engine.  Element (i, j) is at offset i*get<0>(stride()) + j*get<1>(stride()) from
+//  data(), which is the convention used by the strided layouts of mdspan; a row-major buffer has
+//  strides (ld, 1) and a column-major buffer has strides (1, ld), where ld is the leading
+//  dimension.  The engine is writable, unless T is const-qualified, in which case it is readable.
+//
+//  Copying the engine copies the reference, not the elements; assigning from some other engine
+//  type copies the elements into the referenced memory, whose size cannot change.
+//==================================================================================================
+//
+template<class T>
+class span_matrix_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = conditional_t<is_const_v<T>, readable_matrix_engine_tag,
+                                                         writable_matrix_engine_tag>;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+    using stride_tuple    = tuple<difference_type, difference_type>;
+
+    //- Construct/copy/destroy
+    //
+    ~span_matrix_engine() noexcept = default;
+
+    constexpr span_matrix_engine() noexcept;
+    constexpr span_matrix_engine(span_matrix_engine&&) noexcept = default;
+    constexpr span_matrix_engine(span_matrix_engine const&) noexcept = default;
+    constexpr span_matrix_engine(pointer p_elems, size_type rows, size_type cols) noexcept;
+    constexpr span_matrix_engine(pointer p_elems, size_type rows, size_type cols,
+                                 difference_type row_stride, difference_type col_stride) noexcept;
+
+    constexpr span_matrix_engine&   operator =(span_matrix_engine&&) noexcept = default;
+    constexpr span_matrix_engine&   operator =(span_matrix_engine const&) noexcept = default;
+    template<class ET2>
+    constexpr span_matrix_engine&   operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    constexpr size_type     columns() const noexcept;
+    constexpr size_type     rows() const noexcept;
+    constexpr size_tuple    size() const noexcept;
+
+    constexpr size_type     column_capacity() const noexcept;
+    constexpr size_type     row_capacity() const noexcept;
+    constexpr size_tuple    capacity() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference         operator ()(size_type i, size_type j);
+    constexpr const_reference   operator ()(size_type i, size_type j) const;
+
+    //- Layout
+    //
+    constexpr pointer           data() const noexcept;
+    constexpr stride_tuple      stride() const noexcept;
+    constexpr bool              is_contiguous() const noexcept;
+
+    //- Modifiers
+    //
+    constexpr void      swap(span_matrix_engine& rhs) noexcept;
+    constexpr void      swap_columns(size_type j1, size_type j2) noexcept;
+    constexpr void      swap_rows(size_type i1, size_type i2) noexcept;
+
+  private:
+    pointer         mp_elems;
+    size_type       m_rows;
+    size_type       m_cols;
+    difference_type m_row_stride;
+    difference_type m_col_stride;
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T> constexpr
+span_matrix_engine<T>::span_matrix_engine() noexcept
+:   mp_elems(nullptr)
+,   m_rows(0)
+,   m_cols(0)
+,   m_row_stride(0)
+,   m_col_stride(1)
+{}
+
+template<class T> constexpr
+span_matrix_engine<T>::span_matrix_engine(pointer p_elems, size_type rows, size_type cols) noexcept
+:   mp_elems(p_elems)
+,   m_rows(rows)
+,   m_cols(cols)
+,   m_row_stride((difference_type) cols)
+,   m_col_stride(1)
+{}
+
+template<class T> constexpr
+span_matrix_engine<T>::span_matrix_engine
+(pointer p_elems, size_type rows, size_type cols, difference_type row_stride, difference_type col_stride) noexcept
+:   mp_elems(p_elems)
+,   m_rows(rows)
+,   m_cols(cols)
+,   m_row_stride(row_stride)
+,   m_col_stride(col_stride)
+{}
+
+//- As for vectors, a source that is a view (such as the transpose in sm = sm.t()) is copied to a
+//  temporary buffer first, since it may overlap the elements of this engine.
+//
+template<class T>
+template<class ET2> constexpr
+span_matrix_engine<T>&
+span_matrix_engine<T>::operator =(ET2 const& rhs)
+{
+    static_assert(is_writable_engine_v<span_matrix_engine>);
+    static_assert(is_matrix_engine_v<ET2>);
+    using src_size_type = typename ET2::size_type;
+
+    if ((size_type) rhs.rows() != m_rows  ||  (size_type) rhs.columns() != m_cols)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    src_size_type   si, sj;
+    size_type       di, dj;
+
+    if constexpr (detail::is_view_engine_v<ET2>)
+    {
+        std::vector<value_type>     tmp(m_rows * m_cols);
+
+        for (di = 0, si = 0;  di < m_rows;  ++di, ++si)
+        {
+            for (dj = 0, sj = 0;  dj < m_cols;  ++dj, ++sj)
+            {
+                tmp[di*m_cols + dj] = static_cast<value_type>(rhs(si, sj));
+            }
+        }
+        for (di = 0;  di < m_rows;  ++di)
+        {
+            for (dj = 0;  dj < m_cols;  ++dj)
+            {
+                (*this)(di, dj) = std::move(tmp[di*m_cols + dj]);
+            }
+        }
+    }
+    else
+    {
+        for (di = 0, si = 0;  di < m_rows;  ++di, ++si)
+        {
+            for (dj = 0, sj = 0;  dj < m_cols;  ++dj, ++sj)
+            {
+                (*this)(di, dj) = static_cast<value_type>(rhs(si, sj));
+            }
+        }
+    }
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T> constexpr
+typename span_matrix_engine<T>::size_type
+span_matrix_engine<T>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T> constexpr
+typename span_matrix_engine<T>::size_type
+span_matrix_engine<T>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T> constexpr
+typename span_matrix_engine<T>::size_tuple
+span_matrix_engine<T>::size() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T> constexpr
+typename span_matrix_engine<T>::size_type
+span_matrix_engine<T>::column_capacity() const noexcept
+{
+    return m_cols;
+}
+
+template<class T> constexpr
+typename span_matrix_engine<T>::size_type
+span_matrix_engine<T>::row_capacity() const noexcept
+{
+    return m_rows;
+}
+
+template<class T> constexpr
+typename span_matrix_engine<T>::size_tuple
+span_matrix_engine<T>::capacity() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+//----------------
+//- Element access
+//
+template<class T> constexpr
+typename span_matrix_engine<T>::reference
+span_matrix_engine<T>::operator ()(size_type i, size_type j)
+{
+    return mp_elems[(difference_type) i * m_row_stride + (difference_type) j * m_col_stride];
+}
+
+template<class T> constexpr
+typename span_matrix_engine<T>::const_reference
+span_matrix_engine<T>::operator ()(size_type i, size_type j) const
+{
+    return mp_elems[(difference_type) i * m_row_stride + (difference_type) j * m_col_stride];
+}
+
+//--------
+//- Layout
+//
+template<class T> constexpr
+typename span_matrix_engine<T>::pointer
+span_matrix_engine<T>::data() const noexcept
+{
+    return mp_elems;
+}
+
+template<class T> constexpr
+typename span_matrix_engine<T>::stride_tuple
+span_matrix_engine<T>::stride() const noexcept
+{
+    return stride_tuple(m_row_stride, m_col_stride);
+}
+
+//- The elements are contiguous when they are stored densely by rows, with no gaps between them.
+//
+template<class T> constexpr
+bool
+span_matrix_engine<T>::is_contiguous() const noexcept
+{
+    return (m_col_stride == 1  ||  m_cols <= 1)  &&
+           (m_row_stride == (difference_type) m_cols  ||  m_rows <= 1);
+}
+
+//-----------
+//- Modifiers
+//
+template<class T> constexpr
+void
+span_matrix_engine<T>::swap(span_matrix_engine& rhs) noexcept
+{
+    detail::la_swap(mp_elems,     rhs.mp_elems);
+    detail::la_swap(m_rows,       rhs.m_rows);
+    detail::la_swap(m_cols,       rhs.m_cols);
+    detail::la_swap(m_row_stride, rhs.m_row_stride);
+    detail::la_swap(m_col_stride, rhs.m_col_stride);
+}
+
+template<class T> constexpr
+void
+span_matrix_engine<T>::swap_columns(size_type j1, size_type j2) noexcept
+{
+    if (j1 != j2)
+    {
+        for (size_type i = 0;  i < m_rows;  ++i)
+        {
+            detail::la_swap((*this)(i, j1), (*this)(i, j2));
+        }
+    }
+}
+
+template<class T> constexpr
+void
+span_matrix_engine<T>::swap_rows(size_type i1, size_type i2) noexcept
+{
+    if (i1 != i2)
+    {
+        for (size_type j = 0;  j < m_cols;  ++j)
+        {
+            detail::la_swap((*this)(i1, j), (*this)(i2, j));
+        }
+    }
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_SPAN_ENGINES_HPP_DEFINED
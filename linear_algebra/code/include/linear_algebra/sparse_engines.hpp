@@ -0,0 +1,1315 @@
+//==================================================================================================
+//  File:       sparse_engines.hpp
+//
+//  Summary:    This header defines sparse matrix engines, and a builder for assembling them.  In
+//              this context, sparse means that only the (possibly) non-zero elements of a matrix
+//              are stored, along with enough index information to locate them; all other
+//              elements are implicitly zero.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SPARSE_ENGINES_HPP_DEFINED
+#define LINEAR_ALGEBRA_SPARSE_ENGINES_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  A lightweight view of the stored elements in one row of a sparse matrix, along with an
+//  iterator type for visiting them in increasing column order.
+//==================================================================================================
+//
+template<class IT, class T>
+struct sparse_entry
+{
+    IT          column;
+    T const&    value;
+};
+
+template<class IT, class T>
+class sparse_row_iterator
+{
+  public:
+    using iterator_category = input_iterator_tag;
+    using value_type        = sparse_entry<IT, T>;
+    using difference_type   = ptrdiff_t;
+    using pointer           = void;
+    using reference         = sparse_entry<IT, T>;
+
+    constexpr sparse_row_iterator() noexcept;
+    constexpr sparse_row_iterator(IT const* p_col, T const* p_val) noexcept;
+
+    constexpr reference             operator *() const noexcept;
+    constexpr sparse_row_iterator&  operator ++() noexcept;
+    constexpr sparse_row_iterator   operator ++(int) noexcept;
+
+    constexpr bool  operator ==(sparse_row_iterator const& rhs) const noexcept;
+    constexpr bool  operator !=(sparse_row_iterator const& rhs) const noexcept;
+
+  private:
+    IT const*   mp_col;
+    T const*    mp_val;
+};
+
+template<class IT, class T> constexpr
+sparse_row_iterator<IT,T>::sparse_row_iterator() noexcept
+:   mp_col(nullptr)
+,   mp_val(nullptr)
+{}
+
+template<class IT, class T> constexpr
+sparse_row_iterator<IT,T>::sparse_row_iterator(IT const* p_col, T const* p_val) noexcept
+:   mp_col(p_col)
+,   mp_val(p_val)
+{}
+
+template<class IT, class T> constexpr
+typename sparse_row_iterator<IT,T>::reference
+sparse_row_iterator<IT,T>::operator *() const noexcept
+{
+    return reference{*mp_col, *mp_val};
+}
+
+template<class IT, class T> constexpr
+sparse_row_iterator<IT,T>&
+sparse_row_iterator<IT,T>::operator ++() noexcept
+{
+    ++mp_col;
+    ++mp_val;
+    return *this;
+}
+
+template<class IT, class T> constexpr
+sparse_row_iterator<IT,T>
+sparse_row_iterator<IT,T>::operator ++(int) noexcept
+{
+    sparse_row_iterator     prev(*this);
+    ++(*this);
+    return prev;
+}
+
+template<class IT, class T> constexpr
+bool
+sparse_row_iterator<IT,T>::operator ==(sparse_row_iterator const& rhs) const noexcept
+{
+    return mp_col == rhs.mp_col;
+}
+
+template<class IT, class T> constexpr
+bool
+sparse_row_iterator<IT,T>::operator !=(sparse_row_iterator const& rhs) const noexcept
+{
+    return mp_col != rhs.mp_col;
+}
+
+//------
+//
+template<class IT, class T>
+class sparse_row_view
+{
+  public:
+    using iterator  = sparse_row_iterator<IT, T>;
+    using size_type = size_t;
+
+    constexpr sparse_row_view() noexcept;
+    constexpr sparse_row_view(IT const* p_cols, T const* p_vals, size_type count) noexcept;
+
+    constexpr iterator      begin() const noexcept;
+    constexpr iterator      end() const noexcept;
+
+    constexpr size_type     nonzeros() const noexcept;
+    constexpr IT const*     column_indices() const noexcept;
+    constexpr T const*      values() const noexcept;
+
+  private:
+    IT const*   mp_cols;
+    T const*    mp_vals;
+    size_type   m_count;
+};
+
+template<class IT, class T> constexpr
+sparse_row_view<IT,T>::sparse_row_view() noexcept
+:   mp_cols(nullptr)
+,   mp_vals(nullptr)
+,   m_count(0)
+{}
+
+template<class IT, class T> constexpr
+sparse_row_view<IT,T>::sparse_row_view(IT const* p_cols, T const* p_vals, size_type count) noexcept
+:   mp_cols(p_cols)
+,   mp_vals(p_vals)
+,   m_count(count)
+{}
+
+template<class IT, class T> constexpr
+typename sparse_row_view<IT,T>::iterator
+sparse_row_view<IT,T>::begin() const noexcept
+{
+    return iterator(mp_cols, mp_vals);
+}
+
+template<class IT, class T> constexpr
+typename sparse_row_view<IT,T>::iterator
+sparse_row_view<IT,T>::end() const noexcept
+{
+    return iterator(mp_cols + m_count, mp_vals + m_count);
+}
+
+template<class IT, class T> constexpr
+typename sparse_row_view<IT,T>::size_type
+sparse_row_view<IT,T>::nonzeros() const noexcept
+{
+    return m_count;
+}
+
+template<class IT, class T> constexpr
+IT const*
+sparse_row_view<IT,T>::column_indices() const noexcept
+{
+    return mp_cols;
+}
+
+template<class IT, class T> constexpr
+T const*
+sparse_row_view<IT,T>::values() const noexcept
+{
+    return mp_vals;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  Validates compressed-row index arrays describing 'count' stored items of a rows x cols index
+//  space: the offsets must start at zero, end at 'count', and not decrease, and the column indices
+//  within each row must be in range and strictly increasing.
+//--------------------------------------------------------------------------------------------------
+//
+template<class IA>
+void
+check_sparse_structure(size_t rows, size_t cols, IA const& offsets, IA const& indices, size_t count)
+{
+    if (offsets.size() != rows + 1  ||  indices.size() != count  ||  offsets.front() != 0  ||
+        static_cast<size_t>(offsets.back()) != count)
+    {
+        throw runtime_error("invalid sparse structure");
+    }
+
+    //- Check all of the offsets before any of them is used to index the column indices.
+    //
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        if (offsets[i + 1] < offsets[i]  ||  static_cast<size_t>(offsets[i + 1]) > count)
+        {
+            throw runtime_error("invalid sparse structure");
+        }
+    }
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        size_t const    first = static_cast<size_t>(offsets[i]);
+        size_t const    last  = static_cast<size_t>(offsets[i + 1]);
+
+        for (size_t k = first;  k < last;  ++k)
+        {
+            if (static_cast<size_t>(indices[k]) >= cols  ||
+                (k > first  &&  indices[k] <= indices[k - 1]))
+            {
+                throw runtime_error("invalid sparse structure");
+            }
+        }
+    }
+}
+
+}       //- detail namespace
+
+
+//==================================================================================================
+//  Compressed sparse row (CSR) matrix engine.  The stored elements of each row are kept in
+//  increasing column order, and the elements of row i occupy the half-open range given by
+//  [row_offsets()[i], row_offsets()[i+1]) of the column index and value arrays.  The sparsity
+//  structure is fixed after construction, but stored values may be updated in place.
+//==================================================================================================
+//
+template<class T, class IT, class AT>
+class csr_matrix_engine
+{
+    static_assert(is_integral_v<IT>);
+
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using index_type      = IT;
+    using allocator_type  = AT;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using index_array     = std::vector<index_type, detail::rebind_alloc_t<AT, index_type>>;
+    using element_array   = std::vector<element_type, allocator_type>;
+    using row_view_type   = detail::sparse_row_view<index_type, element_type>;
+
+    //- Construct/copy/destroy
+    //
+    ~csr_matrix_engine() noexcept = default;
+
+    csr_matrix_engine();
+    csr_matrix_engine(csr_matrix_engine&& rhs) noexcept;
+    csr_matrix_engine(csr_matrix_engine const& rhs) = default;
+    csr_matrix_engine(size_type rows, size_type cols);
+    csr_matrix_engine(size_type rows, size_type cols, index_array row_offsets,
+                      index_array col_indices, element_array values);
+    template<class ET2>
+    explicit csr_matrix_engine(ET2 const& rhs);
+
+    csr_matrix_engine&  operator =(csr_matrix_engine&& rhs) noexcept;
+    csr_matrix_engine&  operator =(csr_matrix_engine const& rhs) = default;
+    template<class ET2>
+    csr_matrix_engine&  operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    size_type   nonzeros() const noexcept;
+
+    //- Element access
+    //
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    //- Sparse structure access
+    //
+    index_type const*   row_offsets() const noexcept;
+    index_type const*   column_indices() const noexcept;
+    const_pointer       values() const noexcept;
+    pointer             values() noexcept;
+    row_view_type       row_nonzeros(size_type i) const noexcept;
+
+    //- Modifiers
+    //
+    void    swap(csr_matrix_engine& rhs) noexcept;
+
+  private:
+    size_type       m_rows;
+    size_type       m_cols;
+    index_array     m_row_offsets;      //- Holds m_rows + 1 offsets (none when empty)
+    index_array     m_col_indices;      //- Holds one column index per stored element
+    element_array   m_values;           //- Holds the stored elements
+
+    template<class ET2>
+    void    assign(ET2 const& rhs);
+    void    check_sizes(size_type rows, size_type cols);
+    void    check_structure();
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class IT, class AT>
+csr_matrix_engine<T,IT,AT>::csr_matrix_engine()
+:   m_rows(0)
+,   m_cols(0)
+,   m_row_offsets()
+,   m_col_indices()
+,   m_values()
+{}
+
+template<class T, class IT, class AT>
+csr_matrix_engine<T,IT,AT>::csr_matrix_engine(csr_matrix_engine&& rhs) noexcept
+:   csr_matrix_engine()
+{
+    rhs.swap(*this);
+}
+
+template<class T, class IT, class AT>
+csr_matrix_engine<T,IT,AT>::csr_matrix_engine(size_type rows, size_type cols)
+:   m_rows(0)
+,   m_cols(0)
+,   m_row_offsets()
+,   m_col_indices()
+,   m_values()
+{
+    check_sizes(rows, cols);
+    m_row_offsets.assign(rows + 1, index_type(0));
+    m_rows = rows;
+    m_cols = cols;
+}
+
+template<class T, class IT, class AT>
+csr_matrix_engine<T,IT,AT>::csr_matrix_engine
+(size_type rows, size_type cols, index_array row_offsets, index_array col_indices,
+ element_array values)
+:   m_rows(rows)
+,   m_cols(cols)
+,   m_row_offsets(std::move(row_offsets))
+,   m_col_indices(std::move(col_indices))
+,   m_values(std::move(values))
+{
+    check_sizes(rows, cols);
+    check_structure();
+}
+
+template<class T, class IT, class AT>
+template<class ET2>
+csr_matrix_engine<T,IT,AT>::csr_matrix_engine(ET2 const& rhs)
+:   csr_matrix_engine()
+{
+    assign(rhs);
+}
+
+template<class T, class IT, class AT>
+csr_matrix_engine<T,IT,AT>&
+csr_matrix_engine<T,IT,AT>::operator =(csr_matrix_engine&& rhs) noexcept
+{
+    csr_matrix_engine   tmp;
+    tmp.swap(rhs);
+    tmp.swap(*this);
+    return *this;
+}
+
+template<class T, class IT, class AT>
+template<class ET2>
+csr_matrix_engine<T,IT,AT>&
+csr_matrix_engine<T,IT,AT>::operator =(ET2 const& rhs)
+{
+    assign(rhs);
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::size_type
+csr_matrix_engine<T,IT,AT>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::size_type
+csr_matrix_engine<T,IT,AT>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::size_tuple
+csr_matrix_engine<T,IT,AT>::size() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::size_type
+csr_matrix_engine<T,IT,AT>::column_capacity() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::size_type
+csr_matrix_engine<T,IT,AT>::row_capacity() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::size_tuple
+csr_matrix_engine<T,IT,AT>::capacity() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::size_type
+csr_matrix_engine<T,IT,AT>::nonzeros() const noexcept
+{
+    return m_values.size();
+}
+
+//----------------
+//- Element access
+//
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::const_reference
+csr_matrix_engine<T,IT,AT>::operator ()(size_type i, size_type j) const
+{
+    auto const  first = m_col_indices.begin() + m_row_offsets[i];
+    auto const  last  = m_col_indices.begin() + m_row_offsets[i + 1];
+    auto const  iter  = lower_bound(first, last, static_cast<index_type>(j));
+
+    if (iter != last  &&  static_cast<size_type>(*iter) == j)
+    {
+        return m_values[static_cast<size_type>(iter - m_col_indices.begin())];
+    }
+    return value_type();
+}
+
+//-------------------------
+//- Sparse structure access
+//
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::index_type const*
+csr_matrix_engine<T,IT,AT>::row_offsets() const noexcept
+{
+    return m_row_offsets.data();
+}
+
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::index_type const*
+csr_matrix_engine<T,IT,AT>::column_indices() const noexcept
+{
+    return m_col_indices.data();
+}
+
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::const_pointer
+csr_matrix_engine<T,IT,AT>::values() const noexcept
+{
+    return m_values.data();
+}
+
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::pointer
+csr_matrix_engine<T,IT,AT>::values() noexcept
+{
+    return m_values.data();
+}
+
+template<class T, class IT, class AT> inline
+typename csr_matrix_engine<T,IT,AT>::row_view_type
+csr_matrix_engine<T,IT,AT>::row_nonzeros(size_type i) const noexcept
+{
+    size_type const     first = static_cast<size_type>(m_row_offsets[i]);
+    size_type const     last  = static_cast<size_type>(m_row_offsets[i + 1]);
+
+    return row_view_type(m_col_indices.data() + first, m_values.data() + first, last - first);
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class IT, class AT>
+void
+csr_matrix_engine<T,IT,AT>::swap(csr_matrix_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        detail::la_swap(m_rows, rhs.m_rows);
+        detail::la_swap(m_cols, rhs.m_cols);
+        m_row_offsets.swap(rhs.m_row_offsets);
+        m_col_indices.swap(rhs.m_col_indices);
+        m_values.swap(rhs.m_values);
+    }
+}
+
+//------------------------
+//- Private implementation
+//
+template<class T, class IT, class AT>
+template<class ET2>
+void
+csr_matrix_engine<T,IT,AT>::assign(ET2 const& rhs)
+{
+    static_assert(is_matrix_engine_v<ET2>);
+    using src_size_type = typename ET2::size_type;
+
+    size_type const     rows = static_cast<size_type>(rhs.rows());
+    size_type const     cols = static_cast<size_type>(rhs.columns());
+    csr_matrix_engine   tmp(rows, cols);
+
+    src_size_type   si, sj;
+    size_type       di, dj;
+
+    for (di = 0, si = 0;  di < rows;  ++di, ++si)
+    {
+        for (dj = 0, sj = 0;  dj < cols;  ++dj, ++sj)
+        {
+            value_type const    elem = static_cast<value_type>(rhs(si, sj));
+
+            if (elem != value_type())
+            {
+                tmp.m_col_indices.push_back(static_cast<index_type>(dj));
+                tmp.m_values.push_back(elem);
+            }
+        }
+        tmp.m_row_offsets[di + 1] = static_cast<index_type>(tmp.m_values.size());
+    }
+
+    tmp.swap(*this);
+}
+
+template<class T, class IT, class AT>
+void
+csr_matrix_engine<T,IT,AT>::check_sizes(size_type rows, size_type cols)
+{
+    size_type const     max_index = static_cast<size_type>(numeric_limits<index_type>::max());
+
+    if (rows > max_index  ||  cols > max_index)
+    {
+        throw runtime_error("invalid size");
+    }
+}
+
+template<class T, class IT, class AT>
+void
+csr_matrix_engine<T,IT,AT>::check_structure()
+{
+    detail::check_sparse_structure(m_rows, m_cols, m_row_offsets, m_col_indices, m_values.size());
+}
+
+//==================================================================================================
+//  Block compressed sparse row (BSR) matrix engine.  The matrix is partitioned into square B x B
+//  blocks, and only the (possibly) non-zero blocks are stored, each as a fs_matrix_engine<T,B,B>.
+//  The block structure is described in the same way as for csr_matrix_engine, except that the
+//  row offsets and column indices refer to block rows and block columns.
+//==================================================================================================
+//
+template<class T, size_t B, class IT, class AT>
+class bsr_matrix_engine
+{
+    static_assert(B >= 1);
+    static_assert(is_integral_v<IT>);
+
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using index_type      = IT;
+    using allocator_type  = AT;
+    using block_type      = fs_matrix_engine<T, B, B>;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using index_array     = std::vector<index_type, detail::rebind_alloc_t<AT, index_type>>;
+    using block_array     = std::vector<block_type, detail::rebind_alloc_t<AT, block_type>>;
+
+    static constexpr size_type  block_size = B;
+
+    //- Construct/copy/destroy
+    //
+    ~bsr_matrix_engine() noexcept = default;
+
+    bsr_matrix_engine();
+    bsr_matrix_engine(bsr_matrix_engine&& rhs) noexcept;
+    bsr_matrix_engine(bsr_matrix_engine const& rhs) = default;
+    bsr_matrix_engine(size_type block_rows, size_type block_cols);
+    bsr_matrix_engine(size_type block_rows, size_type block_cols, index_array row_offsets,
+                      index_array col_indices, block_array blocks);
+    template<class ET2>
+    explicit bsr_matrix_engine(ET2 const& rhs);
+
+    bsr_matrix_engine&  operator =(bsr_matrix_engine&& rhs) noexcept;
+    bsr_matrix_engine&  operator =(bsr_matrix_engine const& rhs) = default;
+    template<class ET2>
+    bsr_matrix_engine&  operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    size_type   block_columns() const noexcept;
+    size_type   block_rows() const noexcept;
+    size_type   nonzero_blocks() const noexcept;
+
+    //- Element access
+    //
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    //- Sparse structure access
+    //
+    index_type const*   row_offsets() const noexcept;
+    index_type const*   column_indices() const noexcept;
+    block_type const*   blocks() const noexcept;
+    block_type*         blocks() noexcept;
+
+    //- Modifiers
+    //
+    void    swap(bsr_matrix_engine& rhs) noexcept;
+
+  private:
+    size_type       m_brows;
+    size_type       m_bcols;
+    index_array     m_row_offsets;      //- Holds m_brows + 1 offsets (none when empty)
+    index_array     m_col_indices;      //- Holds one block column index per stored block
+    block_array     m_blocks;           //- Holds the stored blocks
+
+    template<class ET2>
+    void    assign(ET2 const& rhs);
+    void    check_sizes(size_type block_rows, size_type block_cols);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, size_t B, class IT, class AT>
+bsr_matrix_engine<T,B,IT,AT>::bsr_matrix_engine()
+:   m_brows(0)
+,   m_bcols(0)
+,   m_row_offsets()
+,   m_col_indices()
+,   m_blocks()
+{}
+
+template<class T, size_t B, class IT, class AT>
+bsr_matrix_engine<T,B,IT,AT>::bsr_matrix_engine(bsr_matrix_engine&& rhs) noexcept
+:   bsr_matrix_engine()
+{
+    rhs.swap(*this);
+}
+
+template<class T, size_t B, class IT, class AT>
+bsr_matrix_engine<T,B,IT,AT>::bsr_matrix_engine(size_type block_rows, size_type block_cols)
+:   m_brows(0)
+,   m_bcols(0)
+,   m_row_offsets()
+,   m_col_indices()
+,   m_blocks()
+{
+    check_sizes(block_rows, block_cols);
+    m_row_offsets.assign(block_rows + 1, index_type(0));
+    m_brows = block_rows;
+    m_bcols = block_cols;
+}
+
+template<class T, size_t B, class IT, class AT>
+bsr_matrix_engine<T,B,IT,AT>::bsr_matrix_engine
+(size_type block_rows, size_type block_cols, index_array row_offsets, index_array col_indices,
+ block_array blocks)
+:   m_brows(block_rows)
+,   m_bcols(block_cols)
+,   m_row_offsets(std::move(row_offsets))
+,   m_col_indices(std::move(col_indices))
+,   m_blocks(std::move(blocks))
+{
+    check_sizes(block_rows, block_cols);
+    detail::check_sparse_structure(m_brows, m_bcols, m_row_offsets, m_col_indices, m_blocks.size());
+}
+
+template<class T, size_t B, class IT, class AT>
+template<class ET2>
+bsr_matrix_engine<T,B,IT,AT>::bsr_matrix_engine(ET2 const& rhs)
+:   bsr_matrix_engine()
+{
+    assign(rhs);
+}
+
+template<class T, size_t B, class IT, class AT>
+bsr_matrix_engine<T,B,IT,AT>&
+bsr_matrix_engine<T,B,IT,AT>::operator =(bsr_matrix_engine&& rhs) noexcept
+{
+    bsr_matrix_engine   tmp;
+    tmp.swap(rhs);
+    tmp.swap(*this);
+    return *this;
+}
+
+template<class T, size_t B, class IT, class AT>
+template<class ET2>
+bsr_matrix_engine<T,B,IT,AT>&
+bsr_matrix_engine<T,B,IT,AT>::operator =(ET2 const& rhs)
+{
+    assign(rhs);
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::size_type
+bsr_matrix_engine<T,B,IT,AT>::columns() const noexcept
+{
+    return m_bcols * B;
+}
+
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::size_type
+bsr_matrix_engine<T,B,IT,AT>::rows() const noexcept
+{
+    return m_brows * B;
+}
+
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::size_tuple
+bsr_matrix_engine<T,B,IT,AT>::size() const noexcept
+{
+    return size_tuple(rows(), columns());
+}
+
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::size_type
+bsr_matrix_engine<T,B,IT,AT>::column_capacity() const noexcept
+{
+    return columns();
+}
+
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::size_type
+bsr_matrix_engine<T,B,IT,AT>::row_capacity() const noexcept
+{
+    return rows();
+}
+
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::size_tuple
+bsr_matrix_engine<T,B,IT,AT>::capacity() const noexcept
+{
+    return size_tuple(rows(), columns());
+}
+
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::size_type
+bsr_matrix_engine<T,B,IT,AT>::block_columns() const noexcept
+{
+    return m_bcols;
+}
+
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::size_type
+bsr_matrix_engine<T,B,IT,AT>::block_rows() const noexcept
+{
+    return m_brows;
+}
+
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::size_type
+bsr_matrix_engine<T,B,IT,AT>::nonzero_blocks() const noexcept
+{
+    return m_blocks.size();
+}
+
+//----------------
+//- Element access
+//
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::const_reference
+bsr_matrix_engine<T,B,IT,AT>::operator ()(size_type i, size_type j) const
+{
+    size_type const     bi    = i / B;
+    size_type const     bj    = j / B;
+    auto const          first = m_col_indices.begin() + m_row_offsets[bi];
+    auto const          last  = m_col_indices.begin() + m_row_offsets[bi + 1];
+    auto const          iter  = lower_bound(first, last, static_cast<index_type>(bj));
+
+    if (iter != last  &&  static_cast<size_type>(*iter) == bj)
+    {
+        return m_blocks[static_cast<size_type>(iter - m_col_indices.begin())](i % B, j % B);
+    }
+    return value_type();
+}
+
+//-------------------------
+//- Sparse structure access
+//
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::index_type const*
+bsr_matrix_engine<T,B,IT,AT>::row_offsets() const noexcept
+{
+    return m_row_offsets.data();
+}
+
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::index_type const*
+bsr_matrix_engine<T,B,IT,AT>::column_indices() const noexcept
+{
+    return m_col_indices.data();
+}
+
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::block_type const*
+bsr_matrix_engine<T,B,IT,AT>::blocks() const noexcept
+{
+    return m_blocks.data();
+}
+
+template<class T, size_t B, class IT, class AT> inline
+typename bsr_matrix_engine<T,B,IT,AT>::block_type*
+bsr_matrix_engine<T,B,IT,AT>::blocks() noexcept
+{
+    return m_blocks.data();
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, size_t B, class IT, class AT>
+void
+bsr_matrix_engine<T,B,IT,AT>::swap(bsr_matrix_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        detail::la_swap(m_brows, rhs.m_brows);
+        detail::la_swap(m_bcols, rhs.m_bcols);
+        m_row_offsets.swap(rhs.m_row_offsets);
+        m_col_indices.swap(rhs.m_col_indices);
+        m_blocks.swap(rhs.m_blocks);
+    }
+}
+
+//------------------------
+//- Private implementation
+//
+//  A block is stored if any of its elements differs from value_type().  The source's dimensions
+//  must be multiples of the block size.
+//
+template<class T, size_t B, class IT, class AT>
+template<class ET2>
+void
+bsr_matrix_engine<T,B,IT,AT>::assign(ET2 const& rhs)
+{
+    static_assert(is_matrix_engine_v<ET2>);
+    using src_size_type = typename ET2::size_type;
+
+    size_type const     rows = static_cast<size_type>(rhs.rows());
+    size_type const     cols = static_cast<size_type>(rhs.columns());
+
+    if (rows % B != 0  ||  cols % B != 0)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    bsr_matrix_engine   tmp(rows / B, cols / B);
+    block_type          blk;
+
+    for (size_type bi = 0;  bi < tmp.m_brows;  ++bi)
+    {
+        for (size_type bj = 0;  bj < tmp.m_bcols;  ++bj)
+        {
+            bool    nonzero = false;
+
+            for (size_type i = 0;  i < B;  ++i)
+            {
+                for (size_type j = 0;  j < B;  ++j)
+                {
+                    blk(i, j) = static_cast<value_type>(rhs(static_cast<src_size_type>(bi*B + i),
+                                                            static_cast<src_size_type>(bj*B + j)));
+                    nonzero   = nonzero  ||  blk(i, j) != value_type();
+                }
+            }
+
+            if (nonzero)
+            {
+                tmp.m_col_indices.push_back(static_cast<index_type>(bj));
+                tmp.m_blocks.push_back(blk);
+            }
+        }
+        tmp.m_row_offsets[bi + 1] = static_cast<index_type>(tmp.m_blocks.size());
+    }
+
+    tmp.swap(*this);
+}
+
+template<class T, size_t B, class IT, class AT>
+void
+bsr_matrix_engine<T,B,IT,AT>::check_sizes(size_type block_rows, size_type block_cols)
+{
+    size_type const     max_index = static_cast<size_type>(numeric_limits<index_type>::max());
+
+    if (block_rows > max_index  ||  block_cols > max_index)
+    {
+        throw runtime_error("invalid size");
+    }
+}
+
+
+//==================================================================================================
+//  Coordinate-format (COO) builder for CSR matrix engines.  Elements are supplied as (i, j, v)
+//  triplets in any order, and may be supplied concurrently from several threads, provided that
+//  each thread appends to its own buffer (identified by a buffer index in [0, buffer_count())).
+//  The finalize() member function sorts the triplets, sums those having the same coordinates,
+//  and returns the resulting CSR engine; the builder is left empty, unless an exception is thrown,
+//  in which case the triplets are kept.
+//==================================================================================================
+//
+template<class T, class IT, class AT>
+class coo_builder
+{
+    static_assert(is_integral_v<IT>);
+
+  public:
+    //- Types
+    //
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using index_type      = IT;
+    using allocator_type  = AT;
+    using size_type       = size_t;
+    using engine_type     = csr_matrix_engine<T, IT, AT>;
+
+    //- Construct/copy/destroy
+    //
+    ~coo_builder() noexcept = default;
+
+    coo_builder(coo_builder&&) noexcept = default;
+    coo_builder(coo_builder const&) = default;
+    coo_builder(size_type rows, size_type cols);
+    coo_builder(size_type rows, size_type cols, size_type buffers);
+
+    coo_builder&    operator =(coo_builder&&) noexcept = default;
+    coo_builder&    operator =(coo_builder const&) = default;
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_type   buffer_count() const noexcept;
+    size_type   triplets() const noexcept;
+
+    void        reserve(size_type buffer, size_type n);
+
+    //- Modifiers
+    //
+    void        append(size_type i, size_type j, value_type const& v);
+    void        append(size_type buffer, size_type i, size_type j, value_type const& v);
+    void        clear() noexcept;
+
+    //- Conversion
+    //
+    engine_type finalize();
+
+  private:
+    struct triplet
+    {
+        index_type  row;
+        index_type  column;
+        value_type  value;
+    };
+
+    struct entry
+    {
+        index_type  column;
+        value_type  value;
+    };
+
+    using triplet_buffer = std::vector<triplet, detail::rebind_alloc_t<AT, triplet>>;
+    using buffer_array   = std::vector<triplet_buffer, detail::rebind_alloc_t<AT, triplet_buffer>>;
+    using entry_array    = std::vector<entry, detail::rebind_alloc_t<AT, entry>>;
+    using offset_array   = std::vector<size_type, detail::rebind_alloc_t<AT, size_type>>;
+
+    size_type       m_rows;
+    size_type       m_cols;
+    buffer_array    m_buffers;      //- One buffer of unsorted triplets per producer
+
+    void    check_sizes(size_type rows, size_type cols, size_type buffers);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class IT, class AT>
+coo_builder<T,IT,AT>::coo_builder(size_type rows, size_type cols)
+:   coo_builder(rows, cols, detail::max_worker_threads())
+{}
+
+template<class T, class IT, class AT>
+coo_builder<T,IT,AT>::coo_builder(size_type rows, size_type cols, size_type buffers)
+:   m_rows(rows)
+,   m_cols(cols)
+,   m_buffers()
+{
+    check_sizes(rows, cols, buffers);
+    m_buffers.resize(buffers);
+}
+
+//----------
+//- Capacity
+//
+template<class T, class IT, class AT> inline
+typename coo_builder<T,IT,AT>::size_type
+coo_builder<T,IT,AT>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class IT, class AT> inline
+typename coo_builder<T,IT,AT>::size_type
+coo_builder<T,IT,AT>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class IT, class AT> inline
+typename coo_builder<T,IT,AT>::size_type
+coo_builder<T,IT,AT>::buffer_count() const noexcept
+{
+    return m_buffers.size();
+}
+
+template<class T, class IT, class AT>
+typename coo_builder<T,IT,AT>::size_type
+coo_builder<T,IT,AT>::triplets() const noexcept
+{
+    size_type   n = 0;
+
+    for (auto const& buffer : m_buffers)
+    {
+        n += buffer.size();
+    }
+    return n;
+}
+
+template<class T, class IT, class AT> inline
+void
+coo_builder<T,IT,AT>::reserve(size_type buffer, size_type n)
+{
+    if (buffer >= m_buffers.size())
+    {
+        throw runtime_error("invalid index");
+    }
+    m_buffers[buffer].reserve(n);
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class IT, class AT> inline
+void
+coo_builder<T,IT,AT>::append(size_type i, size_type j, value_type const& v)
+{
+    append(0u, i, j, v);
+}
+
+template<class T, class IT, class AT> inline
+void
+coo_builder<T,IT,AT>::append(size_type buffer, size_type i, size_type j, value_type const& v)
+{
+    if (buffer >= m_buffers.size()  ||  i >= m_rows  ||  j >= m_cols)
+    {
+        throw runtime_error("invalid index");
+    }
+    m_buffers[buffer].push_back(triplet{static_cast<index_type>(i), static_cast<index_type>(j), v});
+}
+
+template<class T, class IT, class AT>
+void
+coo_builder<T,IT,AT>::clear() noexcept
+{
+    for (auto& buffer : m_buffers)
+    {
+        buffer.clear();
+    }
+}
+
+//------------
+//- Conversion
+//
+//  The triplets are first distributed into row order by a two-pass counting (radix) sort.  The
+//  rows are divided into one contiguous range per task.  In the first pass, each buffer's
+//  histogram over those ranges is computed concurrently, and each buffer is then scattered
+//  concurrently into range order.  In the second pass, each task counts and scatters the
+//  triplets of its own range of rows into row order.  Both passes preserve buffer order, so the
+//  result does not depend on the number of threads, and the scratch space is proportional to
+//  the number of rows and triplets (plus one small histogram per buffer).  Each row is then
+//  sorted by column and its duplicates summed, after which a prefix sum of the per-row counts
+//  yields the row offsets and the rows are compacted into the CSR arrays.
+//
+template<class T, class IT, class AT>
+typename coo_builder<T,IT,AT>::engine_type
+coo_builder<T,IT,AT>::finalize()
+{
+    using index_array   = typename engine_type::index_array;
+    using element_array = typename engine_type::element_array;
+
+    size_type const     nbuf  = m_buffers.size();
+    size_type const     rows  = m_rows;
+    size_type const     total = triplets();
+
+    //- Each task owns the rows [k*width, (k+1)*width); the last range may be shorter.
+    //
+    size_type const     tasks  = detail::task_count(rows, total);
+    size_type const     width  = (rows + tasks - 1) / tasks;
+    size_type const     ranges = (width == 0) ? 0 : (rows + width - 1) / width;
+
+    //- First pass: per-buffer histograms over the row ranges, which become per-buffer scatter
+    //  offsets, followed by the scatter of each buffer into range order.
+    //
+    std::vector<offset_array>   hist(nbuf, offset_array(ranges, size_type(0)));
+    offset_array                range_start(ranges + 1, size_type(0));
+
+    detail::parallel_for(0, nbuf, total, [&](size_type first, size_type last)
+    {
+        for (size_type b = first;  b < last;  ++b)
+        {
+            for (auto const& t : m_buffers[b])
+            {
+                ++hist[b][static_cast<size_type>(t.row) / width];
+            }
+        }
+    });
+
+    for (size_type k = 0, pos = 0;  k < ranges;  ++k)
+    {
+        range_start[k] = pos;
+        for (size_type b = 0;  b < nbuf;  ++b)
+        {
+            size_type const     n = hist[b][k];
+            hist[b][k] = pos;
+            pos += n;
+        }
+    }
+    range_start[ranges] = total;
+
+    triplet_buffer  staged(total);
+
+    detail::parallel_for(0, nbuf, total, [&](size_type first, size_type last)
+    {
+        for (size_type b = first;  b < last;  ++b)
+        {
+            for (auto const& t : m_buffers[b])
+            {
+                staged[hist[b][static_cast<size_type>(t.row) / width]++] = t;
+            }
+        }
+    });
+
+    hist.clear();
+
+    //- Second pass: each task counts the rows in its range, converts the counts into row
+    //  offsets, and scatters its triplets into row order.
+    //
+    offset_array    row_start(rows + 1, size_type(0));
+    offset_array    row_next(rows, size_type(0));
+    entry_array     sorted(total);
+
+    detail::parallel_tasks(ranges, [&](size_type k)
+    {
+        size_type const     first = k * width;
+        size_type const     last  = min(first + width, rows);
+
+        for (size_type p = range_start[k];  p < range_start[k + 1];  ++p)
+        {
+            ++row_next[static_cast<size_type>(staged[p].row)];
+        }
+
+        for (size_type i = first, pos = range_start[k];  i < last;  ++i)
+        {
+            size_type const     n = row_next[i];
+            row_start[i] = row_next[i] = pos;
+            pos += n;
+        }
+
+        for (size_type p = range_start[k];  p < range_start[k + 1];  ++p)
+        {
+            triplet const&  t = staged[p];
+            sorted[row_next[static_cast<size_type>(t.row)]++] = entry{t.column, t.value};
+        }
+    });
+    row_start[rows] = total;
+
+    staged   = triplet_buffer();
+    row_next = offset_array();
+
+    //- Sort each row by column and sum the duplicates in place, recording the surviving count.
+    //
+    offset_array    row_count(rows + 1, size_type(0));
+
+    detail::parallel_for(0, rows, total, [&](size_type first, size_type last)
+    {
+        auto    by_column = [](entry const& a, entry const& b) { return a.column < b.column; };
+
+        for (size_type i = first;  i < last;  ++i)
+        {
+            auto const  p_first = sorted.begin() + row_start[i];
+            auto const  p_last  = sorted.begin() + row_start[i + 1];
+
+            if (p_first == p_last) continue;
+
+            stable_sort(p_first, p_last, by_column);
+
+            auto    p_dst = p_first;
+
+            for (auto p_src = p_first + 1;  p_src != p_last;  ++p_src)
+            {
+                if (p_src->column == p_dst->column)
+                {
+                    p_dst->value += p_src->value;
+                }
+                else
+                {
+                    *++p_dst = *p_src;
+                }
+            }
+            row_count[i + 1] = static_cast<size_type>(p_dst - p_first) + 1;
+        }
+    });
+
+    for (size_type i = 0;  i < rows;  ++i)
+    {
+        row_count[i + 1] += row_count[i];
+    }
+
+    if (row_count[rows] > static_cast<size_type>(numeric_limits<index_type>::max()))
+    {
+        throw runtime_error("invalid size");
+    }
+
+    //- Compact the rows into the CSR arrays.
+    //
+    index_array     offsets(rows + 1);
+    index_array     cols(row_count[rows]);
+    element_array   vals(row_count[rows]);
+
+    detail::parallel_for(0, rows, total, [&](size_type first, size_type last)
+    {
+        for (size_type i = first;  i < last;  ++i)
+        {
+            size_type const     src = row_start[i];
+            size_type const     dst = row_count[i];
+            size_type const     n   = row_count[i + 1] - dst;
+
+            for (size_type k = 0;  k < n;  ++k)
+            {
+                cols[dst + k] = sorted[src + k].column;
+                vals[dst + k] = sorted[src + k].value;
+            }
+            offsets[i + 1] = static_cast<index_type>(row_count[i + 1]);
+        }
+    });
+    offsets[0] = 0;
+
+    engine_type     eng(rows, m_cols, std::move(offsets), std::move(cols), std::move(vals));
+
+    clear();
+    return eng;
+}
+
+//------------------------
+//- Private implementation
+//
+template<class T, class IT, class AT>
+void
+coo_builder<T,IT,AT>::check_sizes(size_type rows, size_type cols, size_type buffers)
+{
+    size_type const     max_index = static_cast<size_type>(numeric_limits<index_type>::max());
+
+    if (rows > max_index  ||  cols > max_index  ||  buffers < 1)
+    {
+        throw runtime_error("invalid size");
+    }
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_SPARSE_ENGINES_HPP_DEFINED
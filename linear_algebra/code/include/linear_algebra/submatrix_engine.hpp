@@ -32,6 +32,7 @@ class submatrix_engine
     using difference_type = typename ET::difference_type;
     using size_type       = typename ET::size_type;
     using size_tuple      = typename ET::size_tuple;
+    using stride_tuple    = tuple<difference_type, difference_type>;
 
     //- Construct/copy/destroy
     //
@@ -58,6 +59,15 @@ class submatrix_engine
     //
     constexpr reference     operator ()(size_type i, size_type j) const;
 
+    //- Layout
+    //
+    template<class ET2 = ET, detail::enable_if_strided<ET, ET2> = true>
+    constexpr pointer           data() const noexcept;
+    template<class ET2 = ET, detail::enable_if_strided<ET, ET2> = true>
+    constexpr stride_tuple      stride() const noexcept;
+    template<class ET2 = ET, detail::enable_if_strided<ET, ET2> = true>
+    constexpr bool              is_contiguous() const noexcept;
+
     //- Modifiers
     //
     constexpr void      swap(submatrix_engine& rhs);
@@ -143,6 +153,37 @@ submatrix_engine<ET, MCT>::operator ()(size_type i, size_type j) const
     return (*mp_other)(i + m_row_start, j + m_col_start);
 }
 
+//--------
+//- Layout
+//
+template<class ET, class MCT>
+template<class ET2, detail::enable_if_strided<ET, ET2>> constexpr 
+typename submatrix_engine<ET, MCT>::pointer
+submatrix_engine<ET, MCT>::data() const noexcept
+{
+    auto const  [rs, cs] = mp_other->stride();
+    return mp_other->data() + static_cast<difference_type>(m_row_start) * rs
+                            + static_cast<difference_type>(m_col_start) * cs;
+}
+
+template<class ET, class MCT>
+template<class ET2, detail::enable_if_strided<ET, ET2>> constexpr 
+typename submatrix_engine<ET, MCT>::stride_tuple
+submatrix_engine<ET, MCT>::stride() const noexcept
+{
+    return mp_other->stride();
+}
+
+template<class ET, class MCT>
+template<class ET2, detail::enable_if_strided<ET, ET2>> constexpr 
+bool
+submatrix_engine<ET, MCT>::is_contiguous() const noexcept
+{
+    auto const  [rs, cs] = mp_other->stride();
+    return (cs == 1  ||  m_col_count <= 1)  &&
+           (rs == static_cast<difference_type>(m_col_count)  ||  m_row_count <= 1);
+}
+
 //-----------
 //- Modifiers
 //
@@ -14,7 +14,7 @@ namespace STD_LA {
 //==================================================================================================
 //
 template<class OT, class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 matrix_subtraction_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>::subtract
 (vector<ET1, OT1> const& v1, vector<ET2, OT2> const& v2) -> result_type
 {
@@ -23,9 +23,9 @@ matrix_subtraction_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>::subtract
     size_type_r const   elems = static_cast<size_type_r>(v1.elements());
 
     result_type     vr;
-    size_type_r     ir;
-    size_type_1     i1;
-    size_type_2     i2;
+    size_type_r     ir = 0;
+    size_type_1     i1 = 0;
+    size_type_2     i2 = 0;
 
     if constexpr (result_requires_resize(vr))
     {
@@ -43,7 +43,7 @@ matrix_subtraction_traits<OT, vector<ET1, OT1>, vector<ET2, OT2>>::subtract
 //------
 //
 template<class OT, class ET1, class OT1, class ET2, class OT2>
-inline auto
+constexpr auto
 matrix_subtraction_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::subtract
 (matrix<ET1, OT1> const& m1, matrix<ET2, OT2> const& m2) -> result_type
 {
@@ -53,9 +53,9 @@ matrix_subtraction_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::subtract
     size_type_r const   cols = static_cast<size_type_r>(m1.columns());
 
     result_type     mr;
-    size_type_r     ir, jr;
-    size_type_1     i1, j1;
-    size_type_2     i2, j2;
+    size_type_r     ir = 0, jr = 0;
+    size_type_1     i1 = 0, j1 = 0;
+    size_type_2     i2 = 0, j2 = 0;
 
     if constexpr (result_requires_resize(mr))
     {
@@ -73,5 +73,61 @@ matrix_subtraction_traits<OT, matrix<ET1, OT1>, matrix<ET2, OT2>>::subtract
     return mr;
 }
 
+//--------------------------------------------------------------------------------------------------
+//- fs_padded_vector-fs_padded_vector.  The operands are combined over whole lanes; their zero
+//  padding yields zero padding in the result.
+//
+template<class OT, class T1, size_t N, size_t A1, class OT1, class T2, size_t A2, class OT2>
+constexpr auto
+matrix_subtraction_traits<OT,
+                          vector<fs_padded_vector_engine<T1, N, A1>, OT1>,
+                          vector<fs_padded_vector_engine<T2, N, A2>, OT2>>::subtract
+(vector<engine_type_1, OT1> const& v1, vector<engine_type_2, OT2> const& v2) -> result_type
+{
+    PrintOperandTypes<result_type>("subtraction_traits (padded)", v1, v2);
+
+    constexpr size_t    P = engine_type_1::padded_elements;
+
+    T1 const* const     p_1 = v1.engine().data();
+    T2 const* const     p_2 = v2.engine().data();
+    result_type         vr;
+    auto* const         p_r = vr.engine().data();
+
+    for (size_t i = 0;  i < P;  ++i)
+    {
+        p_r[i] = p_1[i] - p_2[i];
+    }
+
+    return vr;
+}
+
+//--------------------------------------------------------------------------------------------------
+//- fs_padded_matrix-fs_padded_matrix.  The operands are combined over whole lanes; their zero
+//  padding yields zero padding in the result.
+//
+template<class OT, class T1, size_t R, size_t C, size_t A1, class OT1, class T2, size_t A2, class OT2>
+constexpr auto
+matrix_subtraction_traits<OT,
+                          matrix<fs_padded_matrix_engine<T1, R, C, A1>, OT1>,
+                          matrix<fs_padded_matrix_engine<T2, R, C, A2>, OT2>>::subtract
+(matrix<engine_type_1, OT1> const& m1, matrix<engine_type_2, OT2> const& m2) -> result_type
+{
+    PrintOperandTypes<result_type>("subtraction_traits (padded)", m1, m2);
+
+    constexpr size_t    P = R * engine_type_1::padded_columns;
+
+    T1 const* const     p_1 = m1.engine().data();
+    T2 const* const     p_2 = m2.engine().data();
+    result_type         mr;
+    auto* const         p_r = mr.engine().data();
+
+    for (size_t i = 0;  i < P;  ++i)
+    {
+        p_r[i] = p_1[i] - p_2[i];
+    }
+
+    return mr;
+}
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_SUBTRACTION_TRAITS_IMPL_HPP_DEFINED
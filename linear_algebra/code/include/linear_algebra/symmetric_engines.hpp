@@ -0,0 +1,273 @@
+//==================================================================================================
+//  File:       symmetric_engines.hpp
+//
+//  Summary:    This header defines an owning matrix engine for symmetric matrices, which stores
+//              only one triangle of the matrix in packed form.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SYMMETRIC_ENGINES_HPP_DEFINED
+#define LINEAR_ALGEBRA_SYMMETRIC_ENGINES_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//  Symmetric packed matrix engine.  An n x n symmetric matrix is represented by the n(n+1)/2
+//  elements of its lower triangle, packed by rows; element (i, j) with j <= i is stored at
+//  offset i(i+1)/2 + j.  Element (i, j) with j > i refers to the same storage as element (j, i),
+//  so both reads and writes are mirrored.
+//==================================================================================================
+//
+template<class T, class AT>
+class symmetric_packed_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = writable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using element_array   = std::vector<element_type, allocator_type>;
+
+    //- Construct/copy/destroy
+    //
+    ~symmetric_packed_engine() noexcept = default;
+
+    symmetric_packed_engine();
+    symmetric_packed_engine(symmetric_packed_engine&& rhs) noexcept;
+    symmetric_packed_engine(symmetric_packed_engine const& rhs) = default;
+    explicit symmetric_packed_engine(size_type n);
+    template<class ET2>
+    explicit symmetric_packed_engine(ET2 const& rhs);
+
+    symmetric_packed_engine&    operator =(symmetric_packed_engine&& rhs) noexcept;
+    symmetric_packed_engine&    operator =(symmetric_packed_engine const& rhs) = default;
+    template<class ET2>
+    symmetric_packed_engine&    operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    //- Element access
+    //
+    reference           operator ()(size_type i, size_type j);
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    //- Packed storage access
+    //
+    static size_type    packed_index(size_type i, size_type j) noexcept;
+    const_pointer       packed_data() const noexcept;
+    pointer             packed_data() noexcept;
+
+    //- Modifiers
+    //
+    void    swap(symmetric_packed_engine& rhs) noexcept;
+
+  private:
+    size_type       m_size;
+    element_array   m_elems;        //- Holds m_size * (m_size + 1) / 2 elements
+
+    template<class ET2>
+    void    assign(ET2 const& rhs);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class AT>
+symmetric_packed_engine<T,AT>::symmetric_packed_engine()
+:   m_size(0)
+,   m_elems()
+{}
+
+template<class T, class AT>
+symmetric_packed_engine<T,AT>::symmetric_packed_engine(symmetric_packed_engine&& rhs) noexcept
+:   symmetric_packed_engine()
+{
+    rhs.swap(*this);
+}
+
+template<class T, class AT>
+symmetric_packed_engine<T,AT>::symmetric_packed_engine(size_type n)
+:   m_size(n)
+,   m_elems(n * (n + 1) / 2, value_type())
+{}
+
+template<class T, class AT>
+template<class ET2>
+symmetric_packed_engine<T,AT>::symmetric_packed_engine(ET2 const& rhs)
+:   symmetric_packed_engine()
+{
+    assign(rhs);
+}
+
+template<class T, class AT>
+symmetric_packed_engine<T,AT>&
+symmetric_packed_engine<T,AT>::operator =(symmetric_packed_engine&& rhs) noexcept
+{
+    symmetric_packed_engine     tmp;
+    tmp.swap(rhs);
+    tmp.swap(*this);
+    return *this;
+}
+
+template<class T, class AT>
+template<class ET2>
+symmetric_packed_engine<T,AT>&
+symmetric_packed_engine<T,AT>::operator =(ET2 const& rhs)
+{
+    assign(rhs);
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, class AT> inline
+typename symmetric_packed_engine<T,AT>::size_type
+symmetric_packed_engine<T,AT>::columns() const noexcept
+{
+    return m_size;
+}
+
+template<class T, class AT> inline
+typename symmetric_packed_engine<T,AT>::size_type
+symmetric_packed_engine<T,AT>::rows() const noexcept
+{
+    return m_size;
+}
+
+template<class T, class AT> inline
+typename symmetric_packed_engine<T,AT>::size_tuple
+symmetric_packed_engine<T,AT>::size() const noexcept
+{
+    return size_tuple(m_size, m_size);
+}
+
+template<class T, class AT> inline
+typename symmetric_packed_engine<T,AT>::size_type
+symmetric_packed_engine<T,AT>::column_capacity() const noexcept
+{
+    return m_size;
+}
+
+template<class T, class AT> inline
+typename symmetric_packed_engine<T,AT>::size_type
+symmetric_packed_engine<T,AT>::row_capacity() const noexcept
+{
+    return m_size;
+}
+
+template<class T, class AT> inline
+typename symmetric_packed_engine<T,AT>::size_tuple
+symmetric_packed_engine<T,AT>::capacity() const noexcept
+{
+    return size_tuple(m_size, m_size);
+}
+
+//----------------
+//- Element access
+//
+template<class T, class AT> inline
+typename symmetric_packed_engine<T,AT>::reference
+symmetric_packed_engine<T,AT>::operator ()(size_type i, size_type j)
+{
+    return m_elems[packed_index(i, j)];
+}
+
+template<class T, class AT> inline
+typename symmetric_packed_engine<T,AT>::const_reference
+symmetric_packed_engine<T,AT>::operator ()(size_type i, size_type j) const
+{
+    return m_elems[packed_index(i, j)];
+}
+
+//-----------------------
+//- Packed storage access
+//
+template<class T, class AT> inline
+typename symmetric_packed_engine<T,AT>::size_type
+symmetric_packed_engine<T,AT>::packed_index(size_type i, size_type j) noexcept
+{
+    return (j <= i) ? i*(i + 1)/2 + j : j*(j + 1)/2 + i;
+}
+
+template<class T, class AT> inline
+typename symmetric_packed_engine<T,AT>::const_pointer
+symmetric_packed_engine<T,AT>::packed_data() const noexcept
+{
+    return m_elems.data();
+}
+
+template<class T, class AT> inline
+typename symmetric_packed_engine<T,AT>::pointer
+symmetric_packed_engine<T,AT>::packed_data() noexcept
+{
+    return m_elems.data();
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class AT>
+void
+symmetric_packed_engine<T,AT>::swap(symmetric_packed_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        detail::la_swap(m_size, rhs.m_size);
+        m_elems.swap(rhs.m_elems);
+    }
+}
+
+//------------------------
+//- Private implementation
+//
+//  Only the lower triangle of the source is read; the source must be square.
+//
+template<class T, class AT>
+template<class ET2>
+void
+symmetric_packed_engine<T,AT>::assign(ET2 const& rhs)
+{
+    static_assert(is_matrix_engine_v<ET2>);
+    using src_size_type = typename ET2::size_type;
+
+    size_type const     n = static_cast<size_type>(rhs.rows());
+
+    if (static_cast<size_type>(rhs.columns()) != n)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    symmetric_packed_engine     tmp(n);
+    src_size_type               si, sj;
+    size_type                   di, dj;
+
+    for (di = 0, si = 0;  di < n;  ++di, ++si)
+    {
+        for (dj = 0, sj = 0;  dj <= di;  ++dj, ++sj)
+        {
+            tmp.m_elems[di*(di + 1)/2 + dj] = static_cast<value_type>(rhs(si, sj));
+        }
+    }
+
+    tmp.swap(*this);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_SYMMETRIC_ENGINES_HPP_DEFINED
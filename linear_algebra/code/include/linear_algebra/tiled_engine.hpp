@@ -0,0 +1,413 @@
+//==================================================================================================
+//  File:       tiled_engine.hpp
+//
+//  Summary:    This header defines an owning matrix engine that stores its elements in square
+//              tiles, each of which is contiguous in memory, so that neighbouring elements in
+//              both the row and the column directions are usually close together.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_TILED_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_TILED_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//--------------------------------------------------------------------------------------------------
+//- Returns the Morton (Z-order) key of tile (ti, tj), formed by interleaving the bits of the two
+//  tile coordinates.
+//
+inline uint64_t
+morton_key(size_t ti, size_t tj) noexcept
+{
+    uint64_t    key = 0;
+
+    for (unsigned bit = 0;  bit < 32;  ++bit)
+    {
+        key |= ((static_cast<uint64_t>(tj) >> bit) & 1u) << (2*bit);
+        key |= ((static_cast<uint64_t>(ti) >> bit) & 1u) << (2*bit + 1);
+    }
+    return key;
+}
+
+}   //- detail namespace
+
+
+//==================================================================================================
+//  Tiled matrix engine.  The matrix is divided into B x B tiles, each stored contiguously by rows;
+//  the tiles themselves are stored either by rows of tiles (row_major_tiles_tag) or in Z-order
+//  (z_order_tiles_tag), in which the tiles of each 2 x 2 group of tiles are adjacent at every
+//  scale.  Tiles at the right and bottom edges of the matrix are padded to full size, and the
+//  padding elements are kept at zero, so that kernels may operate on whole tiles.
+//==================================================================================================
+//
+template<class T, size_t B, class AT, class LT>
+class tiled_matrix_engine
+{
+    static_assert(B > 0);
+    static_assert(is_same_v<LT, row_major_tiles_tag>  ||  is_same_v<LT, z_order_tiles_tag>);
+
+  public:
+    //- Types
+    //
+    using engine_category = writable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = element_type&;
+    using const_reference = element_type const&;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+    using layout_type     = LT;
+
+    using element_array   = std::vector<element_type, allocator_type>;
+    using index_array     = std::vector<size_type>;
+
+    static constexpr size_type  tile_size  = B;
+    static constexpr size_type  tile_elems = B * B;
+    static constexpr bool       is_z_order = is_same_v<LT, z_order_tiles_tag>;
+
+    //- Construct/copy/destroy
+    //
+    ~tiled_matrix_engine() noexcept = default;
+
+    tiled_matrix_engine();
+    tiled_matrix_engine(tiled_matrix_engine&& rhs) noexcept;
+    tiled_matrix_engine(tiled_matrix_engine const& rhs) = default;
+    tiled_matrix_engine(size_type rows, size_type cols);
+
+    tiled_matrix_engine&    operator =(tiled_matrix_engine&& rhs) noexcept;
+    tiled_matrix_engine&    operator =(tiled_matrix_engine const& rhs) = default;
+    template<class ET2>
+    tiled_matrix_engine&    operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    size_type   tile_columns() const noexcept;
+    size_type   tile_rows() const noexcept;
+
+    //- Element access
+    //
+    reference           operator ()(size_type i, size_type j);
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    //- Tile access
+    //
+    const_pointer       tile_data(size_type ti, size_type tj) const noexcept;
+    pointer             tile_data(size_type ti, size_type tj) noexcept;
+
+    //- Modifiers
+    //
+    void    swap(tiled_matrix_engine& rhs) noexcept;
+
+  private:
+    size_type       m_rows;
+    size_type       m_cols;
+    size_type       m_tile_rows;
+    size_type       m_tile_cols;
+    element_array   m_elems;        //- Holds m_tile_rows * m_tile_cols tiles
+    index_array     m_tile_slot;    //- Z-order only: the storage slot of each tile, by rows
+
+    size_type   tile_offset(size_type ti, size_type tj) const noexcept;
+
+    template<class ET2>
+    void    assign(ET2 const& rhs);
+    template<class T2, class A2, class LT2>
+    void    assign(tiled_matrix_engine<T2, B, A2, LT2> const& rhs);
+    template<class T2, class A2, class LT2, class MCT2>
+    void    assign(transpose_engine<tiled_matrix_engine<T2, B, A2, LT2>, MCT2> const& rhs);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, size_t B, class AT, class LT>
+tiled_matrix_engine<T,B,AT,LT>::tiled_matrix_engine()
+:   m_rows(0)
+,   m_cols(0)
+,   m_tile_rows(0)
+,   m_tile_cols(0)
+,   m_elems()
+,   m_tile_slot()
+{}
+
+template<class T, size_t B, class AT, class LT>
+tiled_matrix_engine<T,B,AT,LT>::tiled_matrix_engine(tiled_matrix_engine&& rhs) noexcept
+:   tiled_matrix_engine()
+{
+    rhs.swap(*this);
+}
+
+template<class T, size_t B, class AT, class LT>
+tiled_matrix_engine<T,B,AT,LT>::tiled_matrix_engine(size_type rows, size_type cols)
+:   m_rows(rows)
+,   m_cols(cols)
+,   m_tile_rows((rows + B - 1) / B)
+,   m_tile_cols((cols + B - 1) / B)
+,   m_elems(m_tile_rows * m_tile_cols * tile_elems, value_type())
+,   m_tile_slot()
+{
+    if constexpr (is_z_order)
+    {
+        size_type const     tiles = m_tile_rows * m_tile_cols;
+        index_array         order(tiles);
+
+        iota(order.begin(), order.end(), size_type(0));
+        sort(order.begin(), order.end(), [this](size_type a, size_type b)
+        {
+            return detail::morton_key(a / m_tile_cols, a % m_tile_cols) <
+                   detail::morton_key(b / m_tile_cols, b % m_tile_cols);
+        });
+
+        m_tile_slot.resize(tiles);
+        for (size_type slot = 0;  slot < tiles;  ++slot)
+        {
+            m_tile_slot[order[slot]] = slot;
+        }
+    }
+}
+
+template<class T, size_t B, class AT, class LT>
+tiled_matrix_engine<T,B,AT,LT>&
+tiled_matrix_engine<T,B,AT,LT>::operator =(tiled_matrix_engine&& rhs) noexcept
+{
+    tiled_matrix_engine     tmp;
+    tmp.swap(rhs);
+    tmp.swap(*this);
+    return *this;
+}
+
+template<class T, size_t B, class AT, class LT>
+template<class ET2>
+tiled_matrix_engine<T,B,AT,LT>&
+tiled_matrix_engine<T,B,AT,LT>::operator =(ET2 const& rhs)
+{
+    assign(rhs);
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::size_type
+tiled_matrix_engine<T,B,AT,LT>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::size_type
+tiled_matrix_engine<T,B,AT,LT>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::size_tuple
+tiled_matrix_engine<T,B,AT,LT>::size() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::size_type
+tiled_matrix_engine<T,B,AT,LT>::column_capacity() const noexcept
+{
+    return m_tile_cols * B;
+}
+
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::size_type
+tiled_matrix_engine<T,B,AT,LT>::row_capacity() const noexcept
+{
+    return m_tile_rows * B;
+}
+
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::size_tuple
+tiled_matrix_engine<T,B,AT,LT>::capacity() const noexcept
+{
+    return size_tuple(m_tile_rows * B, m_tile_cols * B);
+}
+
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::size_type
+tiled_matrix_engine<T,B,AT,LT>::tile_columns() const noexcept
+{
+    return m_tile_cols;
+}
+
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::size_type
+tiled_matrix_engine<T,B,AT,LT>::tile_rows() const noexcept
+{
+    return m_tile_rows;
+}
+
+//----------------
+//- Element access
+//
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::reference
+tiled_matrix_engine<T,B,AT,LT>::operator ()(size_type i, size_type j)
+{
+    return m_elems[tile_offset(i / B, j / B) + (i % B)*B + (j % B)];
+}
+
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::const_reference
+tiled_matrix_engine<T,B,AT,LT>::operator ()(size_type i, size_type j) const
+{
+    return m_elems[tile_offset(i / B, j / B) + (i % B)*B + (j % B)];
+}
+
+//-------------
+//- Tile access
+//
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::const_pointer
+tiled_matrix_engine<T,B,AT,LT>::tile_data(size_type ti, size_type tj) const noexcept
+{
+    return m_elems.data() + tile_offset(ti, tj);
+}
+
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::pointer
+tiled_matrix_engine<T,B,AT,LT>::tile_data(size_type ti, size_type tj) noexcept
+{
+    return m_elems.data() + tile_offset(ti, tj);
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, size_t B, class AT, class LT>
+void
+tiled_matrix_engine<T,B,AT,LT>::swap(tiled_matrix_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        detail::la_swap(m_rows, rhs.m_rows);
+        detail::la_swap(m_cols, rhs.m_cols);
+        detail::la_swap(m_tile_rows, rhs.m_tile_rows);
+        detail::la_swap(m_tile_cols, rhs.m_tile_cols);
+        m_elems.swap(rhs.m_elems);
+        m_tile_slot.swap(rhs.m_tile_slot);
+    }
+}
+
+//------------------------
+//- Private implementation
+//
+template<class T, size_t B, class AT, class LT> inline
+typename tiled_matrix_engine<T,B,AT,LT>::size_type
+tiled_matrix_engine<T,B,AT,LT>::tile_offset(size_type ti, size_type tj) const noexcept
+{
+    if constexpr (is_z_order)
+    {
+        return m_tile_slot[ti*m_tile_cols + tj] * tile_elems;
+    }
+    else
+    {
+        return (ti*m_tile_cols + tj) * tile_elems;
+    }
+}
+
+template<class T, size_t B, class AT, class LT>
+template<class ET2>
+void
+tiled_matrix_engine<T,B,AT,LT>::assign(ET2 const& rhs)
+{
+    static_assert(is_matrix_engine_v<ET2>);
+    using src_size_type = typename ET2::size_type;
+
+    size_type const         rows = static_cast<size_type>(rhs.rows());
+    size_type const         cols = static_cast<size_type>(rhs.columns());
+    tiled_matrix_engine     tmp(rows, cols);
+    src_size_type           si, sj;
+    size_type               di, dj;
+
+    for (di = 0, si = 0;  di < rows;  ++di, ++si)
+    {
+        for (dj = 0, sj = 0;  dj < cols;  ++dj, ++sj)
+        {
+            tmp(di, dj) = static_cast<value_type>(rhs(si, sj));
+        }
+    }
+
+    tmp.swap(*this);
+}
+
+//- Sources with the same tile size are copied tile by tile, whatever their tile order.
+//
+template<class T, size_t B, class AT, class LT>
+template<class T2, class A2, class LT2>
+void
+tiled_matrix_engine<T,B,AT,LT>::assign(tiled_matrix_engine<T2, B, A2, LT2> const& rhs)
+{
+    tiled_matrix_engine     tmp(rhs.rows(), rhs.columns());
+
+    for (size_type ti = 0;  ti < tmp.m_tile_rows;  ++ti)
+    {
+        for (size_type tj = 0;  tj < tmp.m_tile_cols;  ++tj)
+        {
+            T2 const* const     p_src = rhs.tile_data(ti, tj);
+            pointer const       p_dst = tmp.tile_data(ti, tj);
+
+            for (size_type k = 0;  k < tile_elems;  ++k)
+            {
+                p_dst[k] = static_cast<value_type>(p_src[k]);
+            }
+        }
+    }
+
+    tmp.swap(*this);
+}
+
+//- Transposes of sources with the same tile size are copied tile by tile, with each tile being
+//  transposed in turn; tile (ti, tj) of the result is the transpose of tile (tj, ti) of the source.
+//
+template<class T, size_t B, class AT, class LT>
+template<class T2, class A2, class LT2, class MCT2>
+void
+tiled_matrix_engine<T,B,AT,LT>::assign
+(transpose_engine<tiled_matrix_engine<T2, B, A2, LT2>, MCT2> const& rhs)
+{
+    tiled_matrix_engine<T2, B, A2, LT2> const&  src = rhs.referent();
+    tiled_matrix_engine                         tmp(src.columns(), src.rows());
+
+    detail::parallel_for(0, tmp.m_tile_rows, tmp.m_rows * tmp.m_cols, [&](size_t first, size_t last)
+    {
+        for (size_type ti = first;  ti < last;  ++ti)
+        {
+            for (size_type tj = 0;  tj < tmp.m_tile_cols;  ++tj)
+            {
+                T2 const* const     p_src = src.tile_data(tj, ti);
+                pointer const       p_dst = tmp.tile_data(ti, tj);
+
+                for (size_type i = 0;  i < B;  ++i)
+                {
+                    for (size_type j = 0;  j < B;  ++j)
+                    {
+                        p_dst[i*B + j] = static_cast<value_type>(p_src[j*B + i]);
+                    }
+                }
+            }
+        }
+    });
+
+    tmp.swap(*this);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_TILED_ENGINE_HPP_DEFINED
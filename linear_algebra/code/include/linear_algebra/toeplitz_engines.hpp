@@ -0,0 +1,703 @@
+//==================================================================================================
+//  File:       toeplitz_engines.hpp
+//
+//  Summary:    This header defines owning matrix engines for Toeplitz and circulant matrices,
+//              which are determined by O(n) parameters, along with the fast Fourier transform
+//              used to multiply them by vectors in O(n log n) operations.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_TOEPLITZ_ENGINES_HPP_DEFINED
+#define LINEAR_ALGEBRA_TOEPLITZ_ENGINES_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  Fast Fourier transform support.  The transform of a sequence whose length is a power of two
+//  is computed in place by an iterative radix-2 algorithm; any other length is handled with
+//  Bluestein's algorithm, which re-expresses the transform as a convolution of power-of-two
+//  length.  Both require O(n log n) operations.
+//==================================================================================================
+//
+//- Products of fewer elements than this are computed directly rather than by transforms.
+//
+inline constexpr size_t     fft_min_work = 1u << 12;
+
+//- The real type in which transforms of elements of type T are computed.
+//
+template<class T>
+struct fft_real
+{
+    using type = conditional_t<is_floating_point_v<T>, T, double>;
+};
+
+template<class T>
+struct fft_real<complex<T>>
+{
+    using type = typename fft_real<T>::type;
+};
+
+template<class T>
+using fft_real_t = typename fft_real<T>::type;
+
+//- Converts a transformed value back to the element type R.
+//
+template<class R, class F>
+inline R
+from_fft_value(complex<F> const& z)
+{
+    if constexpr (is_complex_v<R>)
+    {
+        return static_cast<R>(z);
+    }
+    else if constexpr (is_integral_v<R>)
+    {
+        return static_cast<R>(llround(z.real()));
+    }
+    else
+    {
+        return static_cast<R>(z.real());
+    }
+}
+
+inline size_t
+fft_length(size_t n) noexcept
+{
+    size_t  len = 1;
+
+    while (len < n)
+    {
+        len <<= 1;
+    }
+    return len;
+}
+
+template<class F>
+void
+fft_radix2(complex<F>* p_data, size_t n, bool inverse)
+{
+    F const     pi = static_cast<F>(3.14159265358979323846264338327950288L);
+
+    for (size_t i = 1, j = 0;  i < n;  ++i)
+    {
+        size_t  bit = n >> 1;
+
+        for (;  (j & bit) != 0;  bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+
+        if (i < j)
+        {
+            la_swap(p_data[i], p_data[j]);
+        }
+    }
+
+    std::vector<complex<F>>     roots(n / 2);
+    F const                     sign = inverse ? F(1) : F(-1);
+
+    for (size_t k = 0;  k < n / 2;  ++k)
+    {
+        roots[k] = polar(F(1), sign * F(2) * pi * static_cast<F>(k) / static_cast<F>(n));
+    }
+
+    for (size_t len = 2;  len <= n;  len <<= 1)
+    {
+        size_t const    half = len / 2;
+        size_t const    step = n / len;
+
+        for (size_t i = 0;  i < n;  i += len)
+        {
+            for (size_t k = 0;  k < half;  ++k)
+            {
+                complex<F> const    u = p_data[i + k];
+                complex<F> const    v = p_data[i + k + half] * roots[k * step];
+
+                p_data[i + k]        = u + v;
+                p_data[i + k + half] = u - v;
+            }
+        }
+    }
+}
+
+//- Computes the discrete Fourier transform of the given sequence in place; the inverse transform
+//  includes the 1/n scaling.
+//
+template<class F>
+void
+fft(std::vector<complex<F>>& data, bool inverse)
+{
+    size_t const    n = data.size();
+
+    if (n <= 1)
+    {
+        return;
+    }
+
+    if ((n & (n - 1)) == 0)
+    {
+        fft_radix2(data.data(), n, inverse);
+    }
+    else
+    {
+        F const         pi   = static_cast<F>(3.14159265358979323846264338327950288L);
+        F const         sign = inverse ? F(1) : F(-1);
+        size_t const    len  = fft_length(2*n - 1);
+
+        std::vector<complex<F>>     chirp(n), a(len), b(len);
+
+        for (size_t k = 0;  k < n;  ++k)
+        {
+            size_t const    k2 = (k * k) % (2*n);
+
+            chirp[k] = polar(F(1), sign * pi * static_cast<F>(k2) / static_cast<F>(n));
+            a[k]     = data[k] * chirp[k];
+        }
+
+        b[0] = conj(chirp[0]);
+        for (size_t k = 1;  k < n;  ++k)
+        {
+            b[k] = b[len - k] = conj(chirp[k]);
+        }
+
+        fft_radix2(a.data(), len, false);
+        fft_radix2(b.data(), len, false);
+        for (size_t k = 0;  k < len;  ++k)
+        {
+            a[k] *= b[k];
+        }
+        fft_radix2(a.data(), len, true);
+
+        for (size_t k = 0;  k < n;  ++k)
+        {
+            data[k] = a[k] * chirp[k] / static_cast<F>(len);
+        }
+    }
+
+    if (inverse)
+    {
+        for (auto& z : data)
+        {
+            z /= static_cast<F>(n);
+        }
+    }
+}
+
+//- Computes the circular convolution of two sequences of the same length in place in the first.
+//
+template<class F>
+void
+fft_convolve(std::vector<complex<F>>& data, std::vector<complex<F>>& kernel)
+{
+    fft(data, false);
+    fft(kernel, false);
+    for (size_t k = 0;  k < data.size();  ++k)
+    {
+        data[k] *= kernel[k];
+    }
+    fft(data, true);
+}
+
+}   //- detail namespace
+
+
+//==================================================================================================
+//  Toeplitz matrix engine.  Each diagonal of an m x n Toeplitz matrix is constant, so the matrix
+//  is represented by the m + n - 1 values of its diagonals.  The value of diagonal k = j - i,
+//  where -(m - 1) <= k <= n - 1, is stored at offset k + m - 1; thus the storage holds the first
+//  column in reverse order followed by the remainder of the first row.
+//
+//  Individual elements cannot be written, so the engine is readable; the values of the diagonals
+//  are written through the diagonal_value() member function.
+//==================================================================================================
+//
+template<class T, class AT>
+class toeplitz_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using element_array   = std::vector<element_type, allocator_type>;
+
+    //- Construct/copy/destroy
+    //
+    ~toeplitz_engine() noexcept = default;
+
+    toeplitz_engine();
+    toeplitz_engine(toeplitz_engine&& rhs) noexcept;
+    toeplitz_engine(toeplitz_engine const& rhs) = default;
+    toeplitz_engine(size_type rows, size_type cols);
+
+    toeplitz_engine&    operator =(toeplitz_engine&& rhs) noexcept;
+    toeplitz_engine&    operator =(toeplitz_engine const& rhs) = default;
+    template<class ET2>
+    toeplitz_engine&    operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    //- Element access
+    //
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    element_type&       diagonal_value(difference_type k);
+    element_type const& diagonal_value(difference_type k) const;
+
+    //- Diagonal storage access
+    //
+    const_pointer       toeplitz_data() const noexcept;
+    pointer             toeplitz_data() noexcept;
+
+    //- Modifiers
+    //
+    void    swap(toeplitz_engine& rhs) noexcept;
+
+  private:
+    size_type       m_rows;
+    size_type       m_cols;
+    element_array   m_elems;        //- Holds m_rows + m_cols - 1 diagonal values
+
+    template<class ET2>
+    void    assign(ET2 const& rhs);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class AT>
+toeplitz_engine<T,AT>::toeplitz_engine()
+:   m_rows(0)
+,   m_cols(0)
+,   m_elems()
+{}
+
+template<class T, class AT>
+toeplitz_engine<T,AT>::toeplitz_engine(toeplitz_engine&& rhs) noexcept
+:   toeplitz_engine()
+{
+    rhs.swap(*this);
+}
+
+template<class T, class AT>
+toeplitz_engine<T,AT>::toeplitz_engine(size_type rows, size_type cols)
+:   m_rows(rows)
+,   m_cols(cols)
+,   m_elems((rows + cols > 0) ? rows + cols - 1 : 0, value_type())
+{}
+
+template<class T, class AT>
+toeplitz_engine<T,AT>&
+toeplitz_engine<T,AT>::operator =(toeplitz_engine&& rhs) noexcept
+{
+    toeplitz_engine     tmp;
+    tmp.swap(rhs);
+    tmp.swap(*this);
+    return *this;
+}
+
+template<class T, class AT>
+template<class ET2>
+toeplitz_engine<T,AT>&
+toeplitz_engine<T,AT>::operator =(ET2 const& rhs)
+{
+    assign(rhs);
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::size_type
+toeplitz_engine<T,AT>::columns() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::size_type
+toeplitz_engine<T,AT>::rows() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::size_tuple
+toeplitz_engine<T,AT>::size() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::size_type
+toeplitz_engine<T,AT>::column_capacity() const noexcept
+{
+    return m_cols;
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::size_type
+toeplitz_engine<T,AT>::row_capacity() const noexcept
+{
+    return m_rows;
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::size_tuple
+toeplitz_engine<T,AT>::capacity() const noexcept
+{
+    return size_tuple(m_rows, m_cols);
+}
+
+//----------------
+//- Element access
+//
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::const_reference
+toeplitz_engine<T,AT>::operator ()(size_type i, size_type j) const
+{
+    return m_elems[j + m_rows - 1 - i];
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::element_type&
+toeplitz_engine<T,AT>::diagonal_value(difference_type k)
+{
+    return m_elems[static_cast<size_type>(k + static_cast<difference_type>(m_rows) - 1)];
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::element_type const&
+toeplitz_engine<T,AT>::diagonal_value(difference_type k) const
+{
+    return m_elems[static_cast<size_type>(k + static_cast<difference_type>(m_rows) - 1)];
+}
+
+//-------------------------
+//- Diagonal storage access
+//
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::const_pointer
+toeplitz_engine<T,AT>::toeplitz_data() const noexcept
+{
+    return m_elems.data();
+}
+
+template<class T, class AT> inline
+typename toeplitz_engine<T,AT>::pointer
+toeplitz_engine<T,AT>::toeplitz_data() noexcept
+{
+    return m_elems.data();
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class AT>
+void
+toeplitz_engine<T,AT>::swap(toeplitz_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        detail::la_swap(m_rows, rhs.m_rows);
+        detail::la_swap(m_cols, rhs.m_cols);
+        m_elems.swap(rhs.m_elems);
+    }
+}
+
+//------------------------
+//- Private implementation
+//
+//  Only the first column and the first row of the source are read.
+//
+template<class T, class AT>
+template<class ET2>
+void
+toeplitz_engine<T,AT>::assign(ET2 const& rhs)
+{
+    static_assert(is_matrix_engine_v<ET2>);
+    using src_size_type = typename ET2::size_type;
+
+    size_type const     rows = static_cast<size_type>(rhs.rows());
+    size_type const     cols = static_cast<size_type>(rhs.columns());
+    toeplitz_engine     tmp(rows, cols);
+    size_type           i, j;
+
+    for (i = 0;  i < rows;  ++i)
+    {
+        tmp.m_elems[rows - 1 - i] = static_cast<value_type>(rhs(static_cast<src_size_type>(i), 0));
+    }
+    for (j = 1;  j < cols;  ++j)
+    {
+        tmp.m_elems[rows - 1 + j] = static_cast<value_type>(rhs(0, static_cast<src_size_type>(j)));
+    }
+
+    tmp.swap(*this);
+}
+
+
+//==================================================================================================
+//  Circulant matrix engine.  Each column of an n x n circulant matrix is the previous column
+//  rotated down by one, so the matrix is represented by the n elements of its first column;
+//  element (i, j) is element (i - j) mod n of the first column.
+//
+//  Individual elements cannot be written, so the engine is readable; the elements of the first
+//  column are written through the circulant_element() member function.
+//==================================================================================================
+//
+template<class T, class AT>
+class circulant_engine
+{
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using allocator_type  = AT;
+    using pointer         = element_type*;
+    using const_pointer   = element_type const*;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using difference_type = ptrdiff_t;
+    using size_type       = size_t;
+    using size_tuple      = tuple<size_type, size_type>;
+
+    using element_array   = std::vector<element_type, allocator_type>;
+
+    //- Construct/copy/destroy
+    //
+    ~circulant_engine() noexcept = default;
+
+    circulant_engine();
+    circulant_engine(circulant_engine&& rhs) noexcept;
+    circulant_engine(circulant_engine const& rhs) = default;
+    explicit circulant_engine(size_type n);
+
+    circulant_engine&   operator =(circulant_engine&& rhs) noexcept;
+    circulant_engine&   operator =(circulant_engine const& rhs) = default;
+    template<class ET2>
+    circulant_engine&   operator =(ET2 const& rhs);
+
+    //- Capacity
+    //
+    size_type   columns() const noexcept;
+    size_type   rows() const noexcept;
+    size_tuple  size() const noexcept;
+
+    size_type   column_capacity() const noexcept;
+    size_type   row_capacity() const noexcept;
+    size_tuple  capacity() const noexcept;
+
+    //- Element access
+    //
+    const_reference     operator ()(size_type i, size_type j) const;
+
+    element_type&       circulant_element(size_type k);
+    element_type const& circulant_element(size_type k) const;
+
+    //- First column storage access
+    //
+    const_pointer       circulant_data() const noexcept;
+    pointer             circulant_data() noexcept;
+
+    //- Modifiers
+    //
+    void    swap(circulant_engine& rhs) noexcept;
+
+  private:
+    element_array   m_elems;        //- Holds the n elements of the first column
+
+    template<class ET2>
+    void    assign(ET2 const& rhs);
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class T, class AT>
+circulant_engine<T,AT>::circulant_engine()
+:   m_elems()
+{}
+
+template<class T, class AT>
+circulant_engine<T,AT>::circulant_engine(circulant_engine&& rhs) noexcept
+:   circulant_engine()
+{
+    rhs.swap(*this);
+}
+
+template<class T, class AT>
+circulant_engine<T,AT>::circulant_engine(size_type n)
+:   m_elems(n, value_type())
+{}
+
+template<class T, class AT>
+circulant_engine<T,AT>&
+circulant_engine<T,AT>::operator =(circulant_engine&& rhs) noexcept
+{
+    circulant_engine    tmp;
+    tmp.swap(rhs);
+    tmp.swap(*this);
+    return *this;
+}
+
+template<class T, class AT>
+template<class ET2>
+circulant_engine<T,AT>&
+circulant_engine<T,AT>::operator =(ET2 const& rhs)
+{
+    assign(rhs);
+    return *this;
+}
+
+//----------
+//- Capacity
+//
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::size_type
+circulant_engine<T,AT>::columns() const noexcept
+{
+    return m_elems.size();
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::size_type
+circulant_engine<T,AT>::rows() const noexcept
+{
+    return m_elems.size();
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::size_tuple
+circulant_engine<T,AT>::size() const noexcept
+{
+    return size_tuple(m_elems.size(), m_elems.size());
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::size_type
+circulant_engine<T,AT>::column_capacity() const noexcept
+{
+    return m_elems.size();
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::size_type
+circulant_engine<T,AT>::row_capacity() const noexcept
+{
+    return m_elems.size();
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::size_tuple
+circulant_engine<T,AT>::capacity() const noexcept
+{
+    return size_tuple(m_elems.size(), m_elems.size());
+}
+
+//----------------
+//- Element access
+//
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::const_reference
+circulant_engine<T,AT>::operator ()(size_type i, size_type j) const
+{
+    return m_elems[(i >= j) ? i - j : i + m_elems.size() - j];
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::element_type&
+circulant_engine<T,AT>::circulant_element(size_type k)
+{
+    return m_elems[k];
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::element_type const&
+circulant_engine<T,AT>::circulant_element(size_type k) const
+{
+    return m_elems[k];
+}
+
+//------------------------------
+//- First column storage access
+//
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::const_pointer
+circulant_engine<T,AT>::circulant_data() const noexcept
+{
+    return m_elems.data();
+}
+
+template<class T, class AT> inline
+typename circulant_engine<T,AT>::pointer
+circulant_engine<T,AT>::circulant_data() noexcept
+{
+    return m_elems.data();
+}
+
+//-----------
+//- Modifiers
+//
+template<class T, class AT>
+void
+circulant_engine<T,AT>::swap(circulant_engine& rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        m_elems.swap(rhs.m_elems);
+    }
+}
+
+//------------------------
+//- Private implementation
+//
+//  Only the first column of the source is read; the source must be square.
+//
+template<class T, class AT>
+template<class ET2>
+void
+circulant_engine<T,AT>::assign(ET2 const& rhs)
+{
+    static_assert(is_matrix_engine_v<ET2>);
+    using src_size_type = typename ET2::size_type;
+
+    size_type const     n = static_cast<size_type>(rhs.rows());
+
+    if (static_cast<size_type>(rhs.columns()) != n)
+    {
+        throw runtime_error("invalid size");
+    }
+
+    circulant_engine    tmp(n);
+
+    for (size_type i = 0;  i < n;  ++i)
+    {
+        tmp.m_elems[i] = static_cast<value_type>(rhs(static_cast<src_size_type>(i), 0));
+    }
+
+    tmp.swap(*this);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_TOEPLITZ_ENGINES_HPP_DEFINED
@@ -32,6 +32,7 @@ class transpose_engine
     using difference_type = typename ET::difference_type;
     using size_type       = typename ET::size_type;
     using size_tuple      = typename ET::size_tuple;
+    using stride_tuple    = tuple<difference_type, difference_type>;
 
     //- Construct/copy/destroy
     //
@@ -58,6 +59,17 @@ class transpose_engine
     //
     constexpr reference     operator ()(size_type i, size_type j) const;
 
+    constexpr ET const&     referent() const noexcept;
+
+    //- Layout
+    //
+    template<class ET2 = ET, detail::enable_if_strided<ET, ET2> = true>
+    constexpr pointer           data() const noexcept;
+    template<class ET2 = ET, detail::enable_if_strided<ET, ET2> = true>
+    constexpr stride_tuple      stride() const noexcept;
+    template<class ET2 = ET, detail::enable_if_strided<ET, ET2> = true>
+    constexpr bool              is_contiguous() const noexcept;
+
     //- Modifiers
     //
     constexpr void      swap(transpose_engine& rhs);
@@ -134,6 +146,46 @@ transpose_engine<ET, MCT>::operator ()(size_type i, size_type j) const
     return (*mp_other)(j, i);
 }
 
+template<class ET, class MCT> constexpr
+ET const&
+transpose_engine<ET, MCT>::referent() const noexcept
+{
+    return *mp_other;
+}
+
+//--------
+//- Layout
+//
+template<class ET, class MCT>
+template<class ET2, detail::enable_if_strided<ET, ET2>> constexpr 
+typename transpose_engine<ET, MCT>::pointer
+transpose_engine<ET, MCT>::data() const noexcept
+{
+    return mp_other->data();
+}
+
+//- The strides of the referent are exchanged, so that a row-major referent appears as a
+//  column-major matrix.
+//
+template<class ET, class MCT>
+template<class ET2, detail::enable_if_strided<ET, ET2>> constexpr 
+typename transpose_engine<ET, MCT>::stride_tuple
+transpose_engine<ET, MCT>::stride() const noexcept
+{
+    auto const  [rs, cs] = mp_other->stride();
+    return stride_tuple(cs, rs);
+}
+
+//- A transposed view is contiguous in row-major order only when it is a single row or column.
+//
+template<class ET, class MCT>
+template<class ET2, detail::enable_if_strided<ET, ET2>> constexpr 
+bool
+transpose_engine<ET, MCT>::is_contiguous() const noexcept
+{
+    return (mp_other->rows() <= 1  ||  mp_other->columns() <= 1)  &&  mp_other->is_contiguous();
+}
+
 //-----------
 //- Modifiers
 //
@@ -0,0 +1,201 @@
+//==================================================================================================
+//  File:       triangular_engine.hpp
+//
+//  Summary:    This header defines an engine that acts as a "view" of the upper or lower triangle
+//              of a matrix.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_TRIANGULAR_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_TRIANGULAR_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+//==================================================================================================
+//  Matrix triangular engine, meant to act as a "view" of the triangle of a matrix selected by TT
+//  (upper_triangle_tag or lower_triangle_tag).  Elements outside of the triangle read as zero;
+//  if DT is unit_diagonal_tag, the diagonal elements read as one, and the referent's diagonal
+//  is never accessed.  Arithmetic on matrices with this engine visits only the triangle.
+//==================================================================================================
+//
+template<class ET, class TT, class DT>
+class triangular_engine
+{
+    static_assert(is_matrix_engine_v<ET>);
+    static_assert(is_same_v<TT, upper_triangle_tag>  ||  is_same_v<TT, lower_triangle_tag>);
+    static_assert(is_same_v<DT, unit_diagonal_tag>  ||  is_same_v<DT, nonunit_diagonal_tag>);
+
+  public:
+    //- Types
+    //
+    using engine_category = readable_matrix_engine_tag;
+    using element_type    = typename ET::element_type;
+    using value_type      = typename ET::value_type;
+    using pointer         = typename ET::const_pointer;
+    using const_pointer   = typename ET::const_pointer;
+    using reference       = value_type;
+    using const_reference = value_type;
+    using difference_type = typename ET::difference_type;
+    using size_type       = typename ET::size_type;
+    using size_tuple      = typename ET::size_tuple;
+    using referent_type   = ET;
+    using triangle_type   = TT;
+    using diagonal_type   = DT;
+
+    static constexpr bool   is_upper = is_same_v<TT, upper_triangle_tag>;
+    static constexpr bool   is_unit  = is_same_v<DT, unit_diagonal_tag>;
+
+    //- Construct/copy/destroy
+    //
+    ~triangular_engine() noexcept = default;
+
+    constexpr triangular_engine();
+    constexpr explicit triangular_engine(referent_type const& eng);
+    constexpr triangular_engine(triangular_engine&&) noexcept = default;
+    constexpr triangular_engine(triangular_engine const&) = default;
+
+    constexpr triangular_engine&    operator =(triangular_engine&&) noexcept = default;
+    constexpr triangular_engine&    operator =(triangular_engine const&) = default;
+
+    //- Capacity
+    //
+    constexpr size_type     columns() const noexcept;
+    constexpr size_type     rows() const noexcept;
+    constexpr size_tuple    size() const noexcept;
+
+    constexpr size_type     column_capacity() const noexcept;
+    constexpr size_type     row_capacity() const noexcept;
+    constexpr size_tuple    capacity() const noexcept;
+
+    //- Element access
+    //
+    constexpr reference     operator ()(size_type i, size_type j) const;
+
+    constexpr bool                  in_triangle(size_type i, size_type j) const noexcept;
+    constexpr referent_type const&  referent() const noexcept;
+
+    //- Modifiers
+    //
+    constexpr void      swap(triangular_engine& rhs) noexcept;
+
+  private:
+    referent_type const*    mp_other;
+};
+
+//------------------------
+//- Construct/copy/destroy
+//
+template<class ET, class TT, class DT> constexpr
+triangular_engine<ET, TT, DT>::triangular_engine()
+:   mp_other(nullptr)
+{}
+
+template<class ET, class TT, class DT> constexpr
+triangular_engine<ET, TT, DT>::triangular_engine(referent_type const& eng)
+:   mp_other(&eng)
+{}
+
+//----------
+//- Capacity
+//
+template<class ET, class TT, class DT> constexpr
+typename triangular_engine<ET, TT, DT>::size_type
+triangular_engine<ET, TT, DT>::columns() const noexcept
+{
+    return mp_other->columns();
+}
+
+template<class ET, class TT, class DT> constexpr
+typename triangular_engine<ET, TT, DT>::size_type
+triangular_engine<ET, TT, DT>::rows() const noexcept
+{
+    return mp_other->rows();
+}
+
+template<class ET, class TT, class DT> constexpr
+typename triangular_engine<ET, TT, DT>::size_tuple
+triangular_engine<ET, TT, DT>::size() const noexcept
+{
+    return size_tuple(mp_other->rows(), mp_other->columns());
+}
+
+template<class ET, class TT, class DT> constexpr
+typename triangular_engine<ET, TT, DT>::size_type
+triangular_engine<ET, TT, DT>::column_capacity() const noexcept
+{
+    return mp_other->column_capacity();
+}
+
+template<class ET, class TT, class DT> constexpr
+typename triangular_engine<ET, TT, DT>::size_type
+triangular_engine<ET, TT, DT>::row_capacity() const noexcept
+{
+    return mp_other->row_capacity();
+}
+
+template<class ET, class TT, class DT> constexpr
+typename triangular_engine<ET, TT, DT>::size_tuple
+triangular_engine<ET, TT, DT>::capacity() const noexcept
+{
+    return size_tuple(mp_other->row_capacity(), mp_other->column_capacity());
+}
+
+//----------------
+//- Element access
+//
+template<class ET, class TT, class DT> constexpr
+typename triangular_engine<ET, TT, DT>::reference
+triangular_engine<ET, TT, DT>::operator ()(size_type i, size_type j) const
+{
+    if constexpr (is_unit)
+    {
+        if (i == j) return value_type(1);
+    }
+    return in_triangle(i, j) ? value_type((*mp_other)(i, j)) : value_type();
+}
+
+template<class ET, class TT, class DT> constexpr
+bool
+triangular_engine<ET, TT, DT>::in_triangle(size_type i, size_type j) const noexcept
+{
+    if constexpr (is_upper)
+    {
+        return i <= j;
+    }
+    else
+    {
+        return j <= i;
+    }
+}
+
+template<class ET, class TT, class DT> constexpr
+typename triangular_engine<ET, TT, DT>::referent_type const&
+triangular_engine<ET, TT, DT>::referent() const noexcept
+{
+    return *mp_other;
+}
+
+//-----------
+//- Modifiers
+//
+template<class ET, class TT, class DT> constexpr
+void
+triangular_engine<ET, TT, DT>::swap(triangular_engine& rhs) noexcept
+{
+    detail::la_swap(mp_other, rhs.mp_other);
+}
+
+
+//==================================================================================================
+//  Returns a matrix whose engine is a triangular view of the given matrix; for example,
+//  triangular_view<upper_triangle_tag, unit_diagonal_tag>(m).  The view refers to m's engine,
+//  which must outlive it.
+//==================================================================================================
+//
+template<class TT, class DT = nonunit_diagonal_tag, class ET, class OT>
+inline auto
+triangular_view(matrix<ET, OT> const& m)
+{
+    return matrix<triangular_engine<ET, TT, DT>, OT>(triangular_engine<ET, TT, DT>(m.engine()));
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_TRIANGULAR_ENGINE_HPP_DEFINED
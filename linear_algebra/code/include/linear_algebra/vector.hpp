@@ -50,6 +50,8 @@ class vector
     constexpr vector(vector const&) = default;
     template<class ET2, class OT2>
     constexpr vector(vector<ET2, OT2> const& src);
+    constexpr explicit vector(engine_type const& eng);
+    constexpr explicit vector(engine_type&& eng);
 
     template<class U>
     constexpr vector(initializer_list<U> list);
@@ -92,6 +94,8 @@ class vector
     constexpr void      resize(size_type elems);
     template<class ET2 = ET, detail::enable_if_resizable<ET, ET2> = true>
     constexpr void      resize(size_type elems, size_type elemcap);
+    template<class ET2 = ET, detail::enable_if_resizable<ET, ET2> = true>
+    constexpr void      shrink_to_fit();
 
     //- Element access
     //
@@ -116,6 +120,13 @@ class vector
     template<class ET2 = ET, detail::enable_if_writable<ET, ET2> = true>
     constexpr void      swap_elements(size_type i, size_type j) noexcept;
 
+    template<class ET2 = ET, detail::enable_if_resizable<ET, ET2> = true>
+    constexpr void      push_back(value_type const& value);
+    template<class ET2 = ET, detail::enable_if_resizable<ET, ET2> = true>
+    constexpr void      push_back(value_type&& value);
+    template<class ET2 = ET, detail::enable_if_resizable<ET, ET2> = true, class... ARGS>
+    constexpr reference emplace_back(ARGS&&... args);
+
   private:
     template<class ET2, class OT2> friend class vector;
     template<class ET2, class OT2> friend class matrix;
@@ -137,7 +148,19 @@ vector<ET,OT>::vector()
 template<class ET, class OT>
 template<class ET2, class OT2> constexpr
 vector<ET,OT>::vector(vector<ET2, OT2> const& rhs)
-:   m_engine(rhs.m_engine)
+:   m_engine()
+{
+    m_engine = rhs.m_engine;
+}
+
+template<class ET, class OT> constexpr
+vector<ET,OT>::vector(engine_type const& eng)
+:   m_engine(eng)
+{}
+
+template<class ET, class OT> constexpr
+vector<ET,OT>::vector(engine_type&& eng)
+:   m_engine(std::move(eng))
 {}
 
 template<class ET, class OT>
@@ -336,6 +359,14 @@ vector<ET,OT>::resize(size_type elems, size_type cap)
     m_engine.resize(elems, cap);
 }
 
+template<class ET, class OT>
+template<class ET2, detail::enable_if_resizable<ET, ET2>> constexpr
+void
+vector<ET,OT>::shrink_to_fit()
+{
+    m_engine.shrink_to_fit();
+}
+
 //----------------
 //- Element access
 //
@@ -444,6 +475,30 @@ vector<ET,OT>::swap_elements(size_type i, size_type j) noexcept
     m_engine.swap_elements(i, j);
 }
 
+template<class ET, class OT>
+template<class ET2, detail::enable_if_resizable<ET, ET2>> constexpr
+void
+vector<ET,OT>::push_back(value_type const& value)
+{
+    m_engine.push_back(value);
+}
+
+template<class ET, class OT>
+template<class ET2, detail::enable_if_resizable<ET, ET2>> constexpr
+void
+vector<ET,OT>::push_back(value_type&& value)
+{
+    m_engine.push_back(std::move(value));
+}
+
+template<class ET, class OT>
+template<class ET2, detail::enable_if_resizable<ET, ET2>, class... ARGS> constexpr
+typename vector<ET,OT>::reference
+vector<ET,OT>::emplace_back(ARGS&&... args)
+{
+    return m_engine.emplace_back(std::forward<ARGS>(args)...);
+}
+
 //------------
 //- Comparison
 //
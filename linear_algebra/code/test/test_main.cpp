@@ -9,6 +9,8 @@ void TestGroup40();
 void TestGroup50();
 void TestGroup60();
 void TestGroup70();
+void TestGroup80();
+void TestGroup90();
 
 int main()
 {
@@ -20,6 +22,8 @@ int main()
 //	TestGroup50();
 //	TestGroup60();
 //	TestGroup70();
+    TestGroup80();
+    TestGroup90();
 
     return 0;
 }
\ No newline at end of file
@@ -6,6 +6,7 @@ using std::endl;
 
 using fsd_mat_engine_35 = STD_LA::fs_matrix_engine<double, 3, 5>;
 using drd_mat_engine    = STD_LA::dr_matrix_engine<double, std::allocator<double>>;
+using drd_vec_engine    = STD_LA::dr_vector_engine<double, std::allocator<double>>;
 
 using drm_double    = STD_LA::dyn_matrix<double>;
 using drv_double    = STD_LA::dyn_vector<double>;
@@ -144,6 +145,615 @@ void t001()
     //drm_double  mx = {1.0, 1.0, 1.0, 1.0};
 }
 
+void t004()
+{
+    PRINT_FNAME();
+
+    drv_double  v1;
+
+    for (int i = 0;  i < 20;  ++i)
+    {
+        v1.push_back(i);
+    }
+    v1.emplace_back(v1(3));
+    PRINT(v1);
+    cout << "v1 capacity >= size: " << (v1.capacity() >= v1.size()) << endl;
+
+    drm_double  m1;
+    drv_double  r1(4);
+
+    for (int i = 0;  i < 10;  ++i)
+    {
+        for (int j = 0;  j < 4;  ++j)
+        {
+            r1(j) = 10*i + j;
+        }
+        m1.append_row(r1);
+    }
+    PRINT(m1);
+
+    m1.append_row(m1.row(2));
+    PRINT(m1.row(10));
+
+    m1.resize(12, 6);
+    PRINT(m1);
+}
+void t005()
+{
+    PRINT_FNAME();
+
+    drm_double      m1(3, 4), m2(2, 2, 8, 8);
+    fsm_double_35   fm1;
+
+    Fill(m1);
+    Fill(fm1);
+
+    auto const*     p2 = &m2(0, 0);
+
+    m2 = m1;
+    PRINT(m2);
+    m2 = fm1;
+    PRINT(m2);
+    cout << "m2 buffer reused: " << (p2 == &m2(0, 0)) << endl;
+
+    m2 = m2.t();
+    PRINT(m2);
+    m2.shrink_to_fit();
+    PRINT(m2);
+
+    drv_double      v1(3, 10), v2(5);
+
+    Fill(v2);
+    v1 = v2;
+    PRINT(v1);
+    v1.shrink_to_fit();
+    PRINT(v1);
+}
+void t006()
+{
+    PRINT_FNAME();
+
+    drm_double      m1(3, 5, 4, 8);
+    fsm_double_35   fm1;
+
+    Fill(m1);
+
+    STD_LA::dyn_matrix<float>   m2(m1);
+    STD_LA::dyn_matrix<int>     m3(2, 2, 6, 6);
+
+    m3 = m1;
+    fm1 = m2;
+    PRINT(m2);
+    PRINT(m3);
+    PRINT(fm1);
+
+    fsv_double_5                fv1;
+    STD_LA::dyn_vector<float>   v1(fv1);
+
+    fv1 = m2.row(2);
+    v1 = fv1;
+    PRINT(v1);
+}
+void t007()
+{
+    PRINT_FNAME();
+
+    using alloc_traits = std::allocator_traits<std::allocator<double>>;
+
+    std::allocator<double>  alloc;
+    double*                 p_buf = alloc_traits::allocate(alloc, 4*6);
+
+    for (int i = 0;  i < 4*6;  ++i)
+    {
+        alloc_traits::construct(alloc, p_buf + i, i);
+    }
+
+    drm_double  m1(drd_mat_engine(STD_LA::adopt_buffer, p_buf, 3, 5, 4, 6));
+
+    PRINT(m1);
+    cout << "m1 adopted buffer: " << (&m1(0, 0) == p_buf) << endl;
+
+    auto    rel = m1.engine().release();
+
+    cout << "m1 released buffer: " << (rel.data == p_buf) << endl;
+    cout << "released size: " << rel.rows << "x" << rel.columns << endl;
+    cout << "released capacity: " << rel.row_capacity << "x" << rel.column_capacity << endl;
+    PRINT(m1);
+
+    drm_double  m2(drd_mat_engine(STD_LA::adopt_buffer, rel.data, rel.row_capacity, rel.column_capacity,
+                                  rel.row_capacity, rel.column_capacity));
+
+    PRINT(m2);
+
+    drv_double  v1(3, 8);
+
+    Fill(v1);
+
+    auto        vrel = v1.engine().release();
+    drv_double  v2(drd_vec_engine(STD_LA::adopt_buffer, vrel.data, vrel.elements, vrel.capacity));
+
+    cout << "released vector size: " << vrel.elements << ", capacity: " << vrel.capacity << endl;
+    PRINT(v2);
+}
+void t008()
+{
+    PRINT_FNAME();
+
+    using span_mat_engine  = STD_LA::span_matrix_engine<double>;
+    using cspan_mat_engine = STD_LA::span_matrix_engine<double const>;
+    using cspan_vec_engine = STD_LA::span_vector_engine<double const>;
+
+    double      buf1[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    double      buf2[12] = {};
+
+    STD_LA::span_matrix<double const>   sm1(cspan_mat_engine(buf1, 3, 4));
+    STD_LA::span_matrix<double const>   sm2(cspan_mat_engine(buf1, 4, 3, 1, 4));
+    STD_LA::span_vector<double const>   sv1(cspan_vec_engine(buf1, 4, 3));
+    STD_LA::span_matrix<double>         sm3(span_mat_engine(buf2, 3, 3));
+
+    PRINT(sm1);
+    PRINT(sm2);
+    PRINT(sv1);
+    cout << "sm1 contiguous: " << sm1.engine().is_contiguous() << endl;
+    cout << "sm2 contiguous: " << sm2.engine().is_contiguous() << endl;
+
+    PRINT(sm1 * sm2);
+    PRINT(sm2 * sv1);
+
+    drm_double  m1(3, 4);
+
+    Fill(m1);
+    sm3 = m1 * sm2;
+    PRINT(sm3);
+    cout << "buf2[4]: " << buf2[4] << endl;
+
+    //- Assignment from views that overlap the destination.
+    //
+    drm_double  m3;
+
+    sm3 = sm1.submatrix(0, 3, 0, 3);
+    m3  = sm3.t();
+    sm3 = sm3.t();
+    PRINT(sm3);
+    cout << "sm3 == old sm3.t(): " << (sm3 == m3) << endl;
+
+    using span_vec_engine = STD_LA::span_vector_engine<double>;
+
+    STD_LA::span_vector<double>         sv2(span_vec_engine(buf2, 3));
+    STD_LA::span_vector<double const>   sv3(cspan_vec_engine(buf2 + 2, 3, -1));
+    drv_double                          v1;
+
+    v1  = sv3;
+    sv2 = sv3;
+    PRINT(sv2);
+    cout << "sv2 == old reversed sv2: " << (sv2 == v1) << endl;
+}
+
+void t009()
+{
+    PRINT_FNAME();
+
+    drm_double  m1(6, 8);
+    drm_double  m2(4, 3);
+    fsm_double_35   fsm = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+    Fill(m1);
+    Fill(m2);
+    m1.reserve(8, 10);
+
+    auto    sub = m1.submatrix(1, 3, 2, 4);
+    auto    row = m1.row(2);
+    auto    col = m1.column(3);
+
+    cout << "m1 stride: " << std::get<0>(m1.engine().stride()) << ", " << std::get<1>(m1.engine().stride()) << endl;
+    cout << "m1 contiguous: " << m1.engine().is_contiguous() << endl;
+    cout << "sub data offset: " << (sub.engine().data() - m1.engine().data()) << endl;
+    cout << "sub contiguous: " << sub.engine().is_contiguous() << endl;
+    cout << "row data offset: " << (row.engine().data() - m1.engine().data()) << endl;
+    cout << "row stride: " << row.engine().stride() << endl;
+    cout << "col data offset: " << (col.engine().data() - m1.engine().data()) << endl;
+    cout << "col stride: " << col.engine().stride() << endl;
+    cout << "t stride: " << std::get<0>(m1.t().engine().stride()) << ", " << std::get<1>(m1.t().engine().stride()) << endl;
+    cout << "fsm row stride: " << fsm.row(1).engine().stride() << endl;
+
+    drm_double  tsub(sub);
+    drv_double  trow(row);
+    drv_double  tcol(col);
+
+    PRINT(sub);
+    PRINT(sub * m2);
+    PRINT(tsub * m2);
+    PRINT(m2.t() * sub.t());
+    PRINT(sub * m1.submatrix(0, 4, 1, 1).column(0));
+    PRINT(trow);
+    PRINT(tcol);
+}
+
+void t010()
+{
+    PRINT_FNAME();
+
+    using blas_drm_double = STD_LA::matrix<drd_mat_engine, STD_LA::blas_matrix_operations>;
+    using blas_drv_double = STD_LA::vector<STD_LA::dr_vector_engine<double, std::allocator<double>>,
+                                           STD_LA::blas_matrix_operations>;
+    using blas_drm_cplx   = STD_LA::matrix<STD_LA::dr_matrix_engine<std::complex<float>,
+                                                                    std::allocator<std::complex<float>>>,
+                                           STD_LA::blas_matrix_operations>;
+
+    blas_drm_double     m1(4, 5);
+    blas_drm_double     m2(5, 3);
+    blas_drv_double     v1(5);
+    drm_double          m3(4, 5);
+    blas_drm_cplx       c1(2, 2);
+
+    Fill(m1);
+    Fill(m2);
+    Fill(m3);
+    for (size_t i = 0;  i < 5;  ++i) v1(i) = (double) i + 1;
+    c1(0, 0) = {1, 1};  c1(0, 1) = {0, 2};  c1(1, 0) = {3, 0};  c1(1, 1) = {1, -1};
+
+    PRINT(m1 * m2);
+    PRINT(m1.t() * m1.submatrix(0, 4, 1, 3));
+    PRINT(m1 * v1);
+    PRINT(m1.t().t() * m1.row(2));
+    PRINT(m1 + m3);
+    PRINT(m1 + m3.t().t());
+    PRINT(v1 + m1.row(1));
+    cout << "(c1 * c1)(1, 0): " << (c1 * c1)(1, 0) << endl;
+    PRINT((m1 * m2) * m2.t());
+
+    try
+    {
+        PRINT(m1 * m1);
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+}
+
+void t011()
+{
+    PRINT_FNAME();
+
+    using cowm_double = STD_LA::cow_matrix<double>;
+    using cow_engine  = STD_LA::cow_matrix_engine<double, std::allocator<double>>;
+
+    cowm_double     m1(3, 4);
+
+    Fill(m1);
+
+    cowm_double         m2(m1);
+    cowm_double const   snap = m1;
+
+    cout << "m2 shared: " << m2.engine().is_shared() << endl;
+    cout << "same buffer: " << (m1.engine().shared_engine().data() == snap.engine().shared_engine().data()) << endl;
+
+    m1(0, 0) = 100;
+    m2.row(1)(2) = 200;
+
+    cout << "m1 shared after write: " << m1.engine().is_shared() << endl;
+    PRINT(m1);
+    PRINT(m2);
+    PRINT(snap);
+
+    drm_double      dm(2, 2);
+    Fill(dm);
+
+    cowm_double     m3(cow_engine(std::move(dm.engine())));
+    cowm_double     m4;
+
+    m4 = m3;
+    m4.resize(3, 3);
+    PRINT(m3);
+    PRINT(m4);
+    PRINT(snap * m1.t());
+
+    cowm_double     m5 = m3;
+    m5 = m5.t();
+    PRINT(m5);
+    PRINT(m3);
+}
+
+using fsm_double_33 = STD_LA::fs_matrix<double, 3, 3>;
+using fsv_double_3  = STD_LA::fs_vector<double, 3>;
+
+constexpr fsm_double_33 t012_rotation()
+{
+    fsm_double_33   r = {0, -1, 0, 1, 0, 0, 0, 0, 1};
+    return r;
+}
+
+constexpr fsm_double_33 t012_transform()
+{
+    fsm_double_33   s = {2, 0, 0, 0, 3, 0, 0, 0, 1};
+    fsm_double_33   r = t012_rotation();
+
+    return r.t() * (s * r) + (-r) - 2.0 * r + r * 3.0;
+}
+
+void t012()
+{
+    PRINT_FNAME();
+
+    constexpr fsm_double_33     m = t012_transform();
+    constexpr fsv_double_3      v = {1, 2, 3};
+    constexpr fsv_double_3      mv = m * v;
+    constexpr fsv_double_3      vm = v * m - v;
+    constexpr double            vv = v * v;
+
+    static_assert(m(0, 0) == 3  &&  m(1, 1) == 2  &&  m(0, 1) == 0);
+    static_assert(mv(0) == 3  &&  mv(1) == 4  &&  mv(2) == 3);
+    static_assert(vm(0) == 2  &&  vm(2) == 0);
+    static_assert(vv == 14);
+
+    PRINT(m);
+    PRINT(mv);
+    PRINT(vm);
+    cout << "v*v: " << vv << endl;
+}
+
+void t013()
+{
+    PRINT_FNAME();
+
+    using pdm_float_33 = STD_LA::fs_padded_matrix<float, 3, 3>;
+    using pdv_float_3  = STD_LA::fs_padded_vector<float, 3>;
+    using pdm_double_34 = STD_LA::fs_padded_matrix<double, 3, 4, 32>;
+
+    static_assert(sizeof(pdv_float_3) == 16  &&  alignof(pdv_float_3) == 16);
+    static_assert(sizeof(pdm_float_33) == 48  &&  alignof(pdm_float_33) == 16);
+    static_assert(sizeof(pdm_double_34) == 96  &&  alignof(pdm_double_34) == 32);
+
+    constexpr pdm_float_33  r = {0, -1, 0, 1, 0, 0, 0, 0, 1};
+    constexpr pdv_float_3   p = {1, 2, 3};
+    constexpr pdv_float_3   rp = r * p;
+
+    static_assert(rp(0) == -2  &&  rp(1) == 1  &&  rp(2) == 3);
+
+    pdm_float_33    m1 = {1, 2, 3, 4, 5, 6, 7, 8, 10};
+    fsm_double_35   fm;
+
+    Fill(fm);
+
+    auto    m2 = m1 * r + m1.t() - 2.0f * m1;
+    auto    v1 = m2 * p - p;
+
+    PRINT_TYPE(decltype(m2));
+    PRINT_TYPE(decltype(v1));
+    PRINT(m2);
+    PRINT(v1);
+    PRINT(m1 * fm);
+    cout << "m2 padding: " << m2.engine().data()[3] << ", " << m2.engine().data()[11] << endl;
+    cout << "v1 padding: " << v1.engine().data()[3] << endl;
+    cout << "m2 stride: " << std::get<0>(m2.engine().stride()) << endl;
+}
+
+void t014()
+{
+    PRINT_FNAME();
+
+    using STD_LA::bfloat16;
+    using STD_LA::half;
+
+    static_assert(sizeof(bfloat16) == 2  &&  sizeof(half) == 2);
+
+    cout << "bfloat16: " << float(bfloat16(1.0f/3.0f)) << ", " << bfloat16(1.00390625f).bits()
+         << ", " << bfloat16(1.01171875f).bits() << endl;
+    cout << "half: " << float(half(65504.0f)) << ", " << float(half(70000.0f)) << ", "
+         << half(5.9604645e-8f).bits() << ", " << half(1.00048828125f).bits() << endl;
+
+    STD_LA::dyn_matrix<bfloat16>    bm1(40, 300), bm2(300, 20);
+    STD_LA::dyn_matrix<half>        hm1(40, 300), hm2(300, 20);
+    STD_LA::dyn_matrix<float>       fm1(40, 300), fm2(300, 20);
+
+    for (size_t i = 0;  i < 40;  ++i)
+    {
+        for (size_t j = 0;  j < 300;  ++j)
+        {
+            fm1(i, j) = float((i + 3*j) % 7) * 0.125f;
+            bm1(i, j) = fm1(i, j);
+            hm1(i, j) = fm1(i, j);
+        }
+    }
+    for (size_t i = 0;  i < 300;  ++i)
+    {
+        for (size_t j = 0;  j < 20;  ++j)
+        {
+            fm2(i, j) = float((2*i + j) % 5) * 0.25f;
+            bm2(i, j) = fm2(i, j);
+            hm2(i, j) = fm2(i, j);
+        }
+    }
+
+    auto    bm3 = bm1 * bm2 + bm1 * bm2;
+    auto    hm3 = hm1 * hm2 - hm1 * hm2.t().t();
+    auto    bv1 = bm1 * bm2.column(3);
+    auto    fm3 = fm1 * fm2;
+
+    PRINT_TYPE(decltype(bm3));
+    PRINT_TYPE(decltype(hm3));
+    PRINT_TYPE(decltype(bv1));
+
+    float   b_err = 0.0f, h_err = 0.0f, v_err = 0.0f;
+
+    for (size_t i = 0;  i < 40;  ++i)
+    {
+        for (size_t j = 0;  j < 20;  ++j)
+        {
+            b_err = std::max(b_err, std::abs(float(bm3(i, j)) / 2.0f - fm3(i, j)) / fm3(i, j));
+            h_err = std::max(h_err, std::abs(float(hm3(i, j))));
+        }
+        v_err = std::max(v_err, std::abs(float(bv1(i)) - fm3(i, 3)) / fm3(i, 3));
+    }
+    cout << "bfloat16 product relative error within 2^-8: " << (b_err <= 1.0f/256) << endl;
+    cout << "half difference: " << h_err << endl;
+    cout << "bfloat16 column product relative error within 2^-8: " << (v_err <= 1.0f/256) << endl;
+}
+
+void t015()
+{
+    PRINT_FNAME();
+
+    STD_LA::dyn_matrix<int>     m1(3, 3);
+    drm_double                  m2(150, 150), b2(150, 2);
+    drv_double                  v1(3);
+
+    m1(0, 0) = 2;   m1(0, 1) = 0;   m1(0, 2) = 1;
+    m1(1, 0) = 1;   m1(1, 1) = 3;   m1(1, 2) = 2;
+    m1(2, 0) = 1;   m1(2, 1) = 1;   m1(2, 2) = 2;
+    Fill(v1);
+
+    auto    f1 = STD_LA::lu_factor(m1);
+    auto    x1 = solve(m1, v1);
+
+    PRINT_TYPE(decltype(f1));
+    PRINT(f1.packed());
+    cout << "permutation: " << f1.permutation()[0] << f1.permutation()[1] << f1.permutation()[2]
+         << endl;
+    cout << "determinant: " << determinant(m1) << endl;
+    PRINT(x1);
+    PRINT(m1 * x1);
+    PRINT(inverse(m1) * m1);
+
+    for (size_t i = 0;  i < 150;  ++i)
+    {
+        for (size_t j = 0;  j < 150;  ++j)
+        {
+            m2(i, j) = double((7*i + 13*j) % 23) - 11.0 + ((i == j) ? 0.5 : 0.0);
+        }
+        b2(i, 0) = double(i % 5);
+        b2(i, 1) = 1.0;
+    }
+
+    auto    f2 = STD_LA::lu_factorization<double>(drm_double(m2));
+    auto    x2 = f2.solve(b2);
+    auto    r2 = m2 * x2 - b2;
+    auto    i2 = f2.inverse() * m2;
+    double  r_err = 0.0, i_err = 0.0;
+
+    for (size_t i = 0;  i < 150;  ++i)
+    {
+        r_err = std::max({r_err, std::abs(r2(i, 0)), std::abs(r2(i, 1))});
+        for (size_t j = 0;  j < 150;  ++j)
+        {
+            i_err = std::max(i_err, std::abs(i2(i, j) - ((i == j) ? 1.0 : 0.0)));
+        }
+    }
+    cout << "blocked solve residual below 1e-8: " << (r_err < 1e-8) << endl;
+    cout << "blocked inverse error below 1e-8: " << (i_err < 1e-8) << endl;
+    cout << "singular: " << f2.is_singular() << ", "
+         << STD_LA::lu_factor(drm_double(4, 4)).is_singular() << endl;
+}
+
+void t016()
+{
+    PRINT_FNAME();
+
+    drm_double      m1(3, 3), m2(100, 100), m3(104, 104), b2(100, 2);
+    drv_double      v1(3);
+
+    m1(0, 0) = 4;   m1(0, 1) = 2;   m1(0, 2) = -2;
+    m1(1, 0) = 2;   m1(1, 1) = 10;  m1(1, 2) = 2;
+    m1(2, 0) = -2;  m1(2, 1) = 2;   m1(2, 2) = 6;
+    Fill(v1);
+
+    drm_double      l1 = m1;
+
+    STD_LA::cholesky_in_place(l1);
+    PRINT(l1);
+    PRINT(STD_LA::cholesky_solve(l1, v1));
+    PRINT(m1 * STD_LA::cholesky_solve(l1, v1));
+
+    for (size_t i = 0;  i < 100;  ++i)
+    {
+        for (size_t j = 0;  j < 100;  ++j)
+        {
+            m2(i, j) = double((i + j) % 7) - 3.0 + ((i == j) ? 400.0 : 0.0);
+            m3(i + 4, j + 2) = m2(i, j);
+        }
+        b2(i, 0) = double(i % 5);
+        b2(i, 1) = 1.0;
+    }
+
+    auto    s3 = m3.submatrix(4, 100, 2, 100);
+    auto    x2 = b2;
+
+    STD_LA::cholesky_in_place(s3);
+    STD_LA::cholesky_solve_in_place(s3, x2);
+
+    auto    r2 = m2 * x2 - b2;
+    double  r_err = 0.0;
+
+    for (size_t i = 0;  i < 100;  ++i)
+    {
+        r_err = std::max({r_err, std::abs(r2(i, 0)), std::abs(r2(i, 1))});
+    }
+    cout << "submatrix solve residual below 1e-10: " << (r_err < 1e-10) << endl;
+    cout << "upper triangle untouched: " << (m3(4, 3) == m2(0, 1)) << endl;
+
+    try
+    {
+        m1(2, 2) = -6;
+        STD_LA::cholesky_in_place(m1);
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+}
+
+void t017()
+{
+    PRINT_FNAME();
+
+    drm_double      m1(4, 2), m2(120, 70), m3(125, 75), b2(120, 2);
+    drv_double      v1(4);
+
+    for (size_t i = 0;  i < 4;  ++i)
+    {
+        m1(i, 0) = 1;
+        m1(i, 1) = double(i);
+        v1(i)    = 1.0 + 2.0*double(i) + ((i % 2 == 0) ? 0.5 : -0.5);
+    }
+
+    auto    f1 = STD_LA::qr_factor(m1);
+
+    PRINT(f1.r());
+    PRINT(STD_LA::least_squares(m1, v1));
+
+    for (size_t i = 0;  i < 120;  ++i)
+    {
+        for (size_t j = 0;  j < 70;  ++j)
+        {
+            m2(i, j) = double((5*i + 3*j*j) % 17) - 8.0 + ((i == j) ? 20.0 : 0.0);
+            m3(i + 3, j + 5) = m2(i, j);
+        }
+        b2(i, 0) = double(i % 9);
+        b2(i, 1) = 1.0;
+    }
+
+    auto    x2 = STD_LA::least_squares(m2, b2);
+    auto    s3 = m3.submatrix(3, 120, 5, 70);
+    auto    x3 = STD_LA::least_squares_in_place(s3, b2);
+    auto    g2 = m2.t() * (m2 * x2 - b2);
+    auto    r2 = STD_LA::qr_factor(m2).r();
+    auto    d2 = r2.t() * r2 - m2.t() * m2;
+    double  g_err = 0.0, x_err = 0.0, d_err = 0.0;
+
+    for (size_t i = 0;  i < 70;  ++i)
+    {
+        g_err = std::max({g_err, std::abs(g2(i, 0)), std::abs(g2(i, 1))});
+        x_err = std::max({x_err, std::abs(x3(i, 0) - x2(i, 0)), std::abs(x3(i, 1) - x2(i, 1))});
+        for (size_t j = 0;  j < 70;  ++j)
+        {
+            d_err = std::max(d_err, std::abs(d2(i, j)));
+        }
+    }
+    cout << "normal equations residual below 1e-8: " << (g_err < 1e-8) << endl;
+    cout << "in-place submatrix solution matches: " << (x_err < 1e-10) << endl;
+    cout << "R'*R matches A'*A: " << (d_err < 1e-7) << endl;
+}
 
 constexpr double t002()
 {
@@ -181,4 +791,18 @@ TestGroup00()
 
     t000();
     t001();
+    t004();
+    t005();
+    t006();
+    t007();
+    t008();
+    t009();
+    t010();
+    t011();
+    t012();
+    t013();
+    t014();
+    t015();
+    t016();
+    t017();
 }
@@ -0,0 +1,300 @@
+#include "linear_algebra.hpp"
+
+using std::cout;
+using std::endl;
+
+using csr_double_engine = STD_LA::csr_matrix_engine<double, std::uint32_t, std::allocator<double>>;
+
+using csr_double    = STD_LA::csr_matrix<double>;
+using csr_double_32 = STD_LA::matrix<csr_double_engine>;
+using drm_double    = STD_LA::dyn_matrix<double>;
+using drv_double    = STD_LA::dyn_vector<double>;
+using fsv_double_5  = STD_LA::fs_vector<double, 5>;
+
+//--------------------------------------------------------------------------------------------------
+//  This test exercises construction of, and element access to, CSR matrices.
+//--------------------------------------------------------------------------------------------------
+//
+void t800()
+{
+    PRINT_FNAME();
+
+    drm_double  dm(4, 5);
+
+    dm(0, 0) = 1;   dm(0, 3) = 2;
+    dm(1, 1) = 3;
+    dm(3, 2) = 4;   dm(3, 4) = 5;
+
+    csr_double  sm1;
+
+    sm1 = dm;
+    PRINT(sm1);
+    cout << "sm1 == dm: " << (sm1 == dm) << endl;
+    cout << "nonzeros: " << sm1.engine().nonzeros() << endl;
+
+    for (auto entry : sm1.engine().row_nonzeros(3))
+    {
+        cout << "  (3, " << entry.column << ") = " << entry.value << endl;
+    }
+
+    csr_double_engine::index_array      offs = {0, 2, 3, 3, 5};
+    csr_double_engine::index_array      cols = {0, 3, 1, 2, 4};
+    csr_double_engine::element_array    vals = {1, 2, 3, 4, 5};
+
+    csr_double_32   sm2(csr_double_engine(4, 5, std::move(offs), std::move(cols), std::move(vals)));
+    PRINT(sm2);
+    cout << "sm2 == sm1: " << (sm2 == sm1) << endl;
+    PRINT(sm2.t());
+
+    try
+    {
+        csr_double_engine::index_array      bad_offs = {0, 5, 3};
+        csr_double_engine::index_array      bad_cols = {0, 1, 2};
+        csr_double_engine::element_array    bad_vals = {1, 2, 3};
+
+        csr_double_engine   bad(2, 3, std::move(bad_offs), std::move(bad_cols), std::move(bad_vals));
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test verifies the result types and values of sparse*dense multiplications.
+//--------------------------------------------------------------------------------------------------
+//
+void t801()
+{
+    PRINT_FNAME();
+
+    static_assert(std::is_same_v<decltype(std::declval<csr_double>() * std::declval<drv_double>()), drv_double>);
+    static_assert(std::is_same_v<decltype(std::declval<csr_double>() * std::declval<fsv_double_5>()), drv_double>);
+    static_assert(std::is_same_v<decltype(std::declval<csr_double>() * std::declval<drm_double>()), drm_double>);
+
+    drm_double  dm(4, 5), dm2(5, 3);
+    drv_double  dv(5);
+
+    dm(0, 0) = 1;   dm(0, 3) = 2;
+    dm(1, 1) = 3;
+    dm(3, 2) = 4;   dm(3, 4) = 5;
+    Fill(dv);
+    Fill(dm2);
+
+    csr_double  sm;
+
+    sm = dm;
+    PRINT(sm * dv);
+    cout << "sm * dv == dm * dv: " << (sm * dv == dm * dv) << endl;
+    PRINT(sm * dm2);
+    cout << "sm * dm2 == dm * dm2: " << (sm * dm2 == dm * dm2) << endl;
+
+    try
+    {
+        PRINT(sm * drv_double(4));
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+
+    try
+    {
+        PRINT(sm * dm);
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test exercises assembly of CSR matrices from unordered triplets, including duplicates.
+//--------------------------------------------------------------------------------------------------
+//
+void t802()
+{
+    PRINT_FNAME();
+
+    STD_LA::coo_builder<double>     bld(4, 5, 2);
+
+    bld.append(1, 3, 0, 2.0);
+    bld.append(0, 0, 3, 1.5);
+    bld.append(1, 1, 1, 3.0);
+    bld.append(0, 0, 0, 1.0);
+    bld.append(1, 0, 3, 0.5);
+    bld.append(0, 3, 4, 5.0);
+    bld.append(1, 3, 2, 4.0);
+    bld.append(3, 0, 2.0);
+    cout << "triplets: " << bld.triplets() << endl;
+
+    csr_double  sm(bld.finalize());
+    PRINT(sm);
+    cout << "nonzeros: " << sm.engine().nonzeros() << endl;
+    cout << "triplets: " << bld.triplets() << endl;
+
+    //- Assemble a larger matrix from four threads, each appending to its own buffer, and compare
+    //  it with the same triplets appended serially to a single buffer, and summed densely.
+    //
+    size_t const                    nr = 400, nc = 300, per_thread = 50000;
+    STD_LA::coo_builder<double>     pbld(nr, nc, 4), sbld(nr, nc, 1);
+    drm_double                      dm(nr, nc);
+    std::vector<std::thread>        workers;
+
+    auto    coord = [=](size_t t, size_t k)
+    {
+        size_t const    h = ((t * per_thread + k) * 2654435761u) & 0xFFFFFFFFu;
+        return std::make_pair(h % nr, (h / nr) % nc);
+    };
+
+    for (size_t t = 0;  t < 4;  ++t)
+    {
+        workers.emplace_back([&, t]()
+        {
+            for (size_t k = 0;  k < per_thread;  ++k)
+            {
+                auto const  ij = coord(t, k);
+                pbld.append(t, ij.first, ij.second, static_cast<double>(k % 5 + 1));
+            }
+        });
+    }
+    for (auto& w : workers)
+    {
+        w.join();
+    }
+
+    for (size_t t = 0;  t < 4;  ++t)
+    {
+        for (size_t k = 0;  k < per_thread;  ++k)
+        {
+            auto const  ij = coord(t, k);
+            sbld.append(ij.first, ij.second, static_cast<double>(k % 5 + 1));
+            dm(ij.first, ij.second) += static_cast<double>(k % 5 + 1);
+        }
+    }
+    cout << "triplets: " << pbld.triplets() << endl;
+
+    csr_double  psm(pbld.finalize());
+    csr_double  ssm(sbld.finalize());
+
+    cout << "parallel == serial: " << (psm == ssm) << endl;
+    cout << "parallel == dense: " << (psm == dm) << endl;
+    cout << "nonzeros: " << psm.engine().nonzeros() << endl;
+
+    //- Out-of-range indices are rejected when appended, and a failed finalize() keeps the
+    //  triplets; 400 nonzeros cannot be indexed with an 8-bit index type.
+    //
+    STD_LA::coo_builder<double, std::uint8_t>   bbld(20, 20, 1);
+
+    for (size_t i = 0;  i < 20;  ++i)
+    {
+        for (size_t j = 0;  j < 20;  ++j)
+        {
+            bbld.append(i, j, 1.0);
+        }
+    }
+
+    try
+    {
+        bbld.append(20, 0, 1.0);
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+
+    try
+    {
+        bbld.append(1, 0, 0, 1.0);
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+
+    try
+    {
+        auto    eng = bbld.finalize();
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+    cout << "triplets: " << bbld.triplets() << endl;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test verifies the result type and values of sparse*sparse multiplication.
+//--------------------------------------------------------------------------------------------------
+//
+void t803()
+{
+    PRINT_FNAME();
+
+    static_assert(std::is_same_v<decltype(std::declval<csr_double>() * std::declval<csr_double>()), csr_double>);
+    static_assert(std::is_same_v<decltype(std::declval<csr_double_32>() * std::declval<csr_double_32>()), csr_double_32>);
+
+    drm_double  dm1(4, 5), dm2(5, 3);
+
+    dm1(0, 0) = 1;  dm1(0, 3) = 2;
+    dm1(1, 1) = 3;
+    dm1(3, 2) = 4;  dm1(3, 4) = 5;
+
+    dm2(0, 2) = 1;
+    dm2(1, 0) = 2;  dm2(1, 1) = -1;
+    dm2(3, 2) = 3;
+    dm2(4, 0) = 4;
+
+    csr_double  sm1, sm2;
+
+    sm1 = dm1;
+    sm2 = dm2;
+    PRINT(sm1 * sm2);
+    cout << "sm1 * sm2 == dm1 * dm2: " << (sm1 * sm2 == dm1 * dm2) << endl;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test exercises construction of BSR matrices, and block-sparse*dense multiplication.
+//--------------------------------------------------------------------------------------------------
+//
+void t804()
+{
+    PRINT_FNAME();
+
+    using bsr_double_2 = STD_LA::bsr_matrix<double, 2>;
+
+    static_assert(std::is_same_v<decltype(std::declval<bsr_double_2>() * std::declval<drv_double>()), drv_double>);
+    static_assert(std::is_same_v<decltype(std::declval<bsr_double_2>() * std::declval<drm_double>()), drm_double>);
+
+    drm_double  dm(4, 6), dm2(6, 3);
+    drv_double  dv(6);
+
+    dm(0, 0) = 1;   dm(0, 1) = 2;   dm(1, 1) = 3;
+    dm(2, 4) = 4;   dm(3, 5) = 5;
+    Fill(dv);
+    Fill(dm2);
+
+    bsr_double_2    bm;
+
+    bm = dm;
+    PRINT(bm);
+    cout << "nonzero blocks: " << bm.engine().nonzero_blocks() << endl;
+    cout << "bm == dm: " << (bm == dm) << endl;
+
+    PRINT(bm * dv);
+    cout << "bm * dv == dm * dv: " << (bm * dv == dm * dv) << endl;
+    PRINT(bm * dm2);
+    cout << "bm * dm2 == dm * dm2: " << (bm * dm2 == dm * dm2) << endl;
+}
+
+void
+TestGroup80()
+{
+    PRINT_FNAME();
+
+    t800();
+    t801();
+    t802();
+    t803();
+    t804();
+}
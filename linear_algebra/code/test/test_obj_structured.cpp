@@ -0,0 +1,607 @@
+#include "linear_algebra.hpp"
+
+using std::cout;
+using std::endl;
+
+using band_double_engine = STD_LA::banded_matrix_engine<double, std::allocator<double>>;
+
+using band_double   = STD_LA::banded_matrix<double>;
+using sym_double    = STD_LA::symmetric_matrix<double>;
+using diag_double   = STD_LA::diagonal_matrix<double>;
+using id_double     = STD_LA::identity_matrix<double>;
+using lr_double     = STD_LA::low_rank_matrix<double>;
+using toe_double    = STD_LA::toeplitz_matrix<double>;
+using circ_double   = STD_LA::circulant_matrix<double>;
+using tile_double   = STD_LA::tiled_matrix<double, 4>;
+using ztile_double  = STD_LA::tiled_matrix<double, 4, std::allocator<double>, STD_LA::z_order_tiles_tag>;
+using drm_double    = STD_LA::dyn_matrix<double>;
+using drv_double    = STD_LA::dyn_vector<double>;
+
+//--------------------------------------------------------------------------------------------------
+//  This test exercises construction of, element access to, and multiplication of banded matrices.
+//--------------------------------------------------------------------------------------------------
+//
+void t900()
+{
+    PRINT_FNAME();
+
+    static_assert(std::is_same_v<decltype(std::declval<band_double>() * std::declval<drv_double>()), drv_double>);
+    static_assert(std::is_same_v<decltype(std::declval<band_double>() * std::declval<drm_double>()), drm_double>);
+    static_assert(std::is_same_v<decltype(std::declval<band_double>() * std::declval<band_double>()), band_double>);
+
+    drm_double  dm(5, 5), dm2(5, 3);
+    drv_double  dv(5);
+
+    for (size_t i = 0;  i < 5;  ++i)
+    {
+        dm(i, i) = 4;
+        if (i > 0) dm(i, i - 1) = -1;
+        if (i + 2 < 5) dm(i, i + 2) = 2;
+    }
+    Fill(dv);
+    Fill(dm2);
+
+    band_double     bm;
+
+    bm = dm;
+    PRINT(bm);
+    cout << "bandwidths: " << bm.engine().lower_bandwidth() << ", " << bm.engine().upper_bandwidth() << endl;
+    cout << "bm == dm: " << (bm == dm) << endl;
+
+    bm.engine().band_element(0, 1) = 1;
+    dm(0, 1) = 1;
+    cout << "bm == dm: " << (bm == dm) << endl;
+
+    PRINT(bm * dv);
+    cout << "bm * dv == dm * dv: " << (bm * dv == dm * dv) << endl;
+    PRINT(bm * dm2);
+    cout << "bm * dm2 == dm * dm2: " << (bm * dm2 == dm * dm2) << endl;
+    PRINT(bm * bm);
+    cout << "bm * bm == dm * dm: " << (bm * bm == dm * dm) << endl;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test exercises the banded (tridiagonal and general) solvers.
+//--------------------------------------------------------------------------------------------------
+//
+void t901()
+{
+    PRINT_FNAME();
+
+    band_double     tri(band_double_engine(6, 6, 1, 1));
+    band_double     gen(band_double_engine(6, 6, 2, 1));
+    drv_double      b(6);
+
+    for (size_t i = 0;  i < 6;  ++i)
+    {
+        tri.engine().band_element(i, i) = 4;
+        gen.engine().band_element(i, i) = (i % 2 == 0) ? 0.5 : 3;
+        if (i > 0)
+        {
+            tri.engine().band_element(i, i - 1) = -1;
+            gen.engine().band_element(i, i - 1) = 2;
+        }
+        if (i > 1)
+        {
+            gen.engine().band_element(i, i - 2) = 1;
+        }
+        if (i + 1 < 6)
+        {
+            tri.engine().band_element(i, i + 1) = -1;
+            gen.engine().band_element(i, i + 1) = -1;
+        }
+    }
+    Fill(b);
+
+    auto    x1 = solve(tri, b);
+    PRINT(x1);
+    PRINT(tri * x1);
+
+    auto    x2 = solve(gen, b);
+    PRINT(x2);
+    PRINT(gen * x2);
+
+    STD_LA::banded_matrix<int>  itri(STD_LA::banded_matrix_engine<int, std::allocator<int>>(3, 3, 1, 1));
+    STD_LA::dyn_vector<int>     ib(3);
+
+    for (size_t i = 0;  i < 3;  ++i)
+    {
+        itri.engine().band_element(i, i) = (i == 1) ? 3 : 2;
+        if (i > 0)
+        {
+            itri.engine().band_element(i, i - 1) = 1;
+            itri.engine().band_element(i - 1, i) = 1;
+        }
+        ib(i) = static_cast<int>(i + 1);
+    }
+
+    auto    x3 = solve(itri, ib);
+    static_assert(std::is_same_v<decltype(x3), drv_double>);
+    PRINT(x3);
+    cout << "integer system solved in double: "
+         << (std::abs(x3(0) - 0.5) < 1e-12 && std::abs(x3(1)) < 1e-12 && std::abs(x3(2) - 1.5) < 1e-12) << endl;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test exercises symmetric packed matrices, their products, and the Gram product.
+//--------------------------------------------------------------------------------------------------
+//
+void t902()
+{
+    PRINT_FNAME();
+
+    static_assert(std::is_same_v<decltype(std::declval<sym_double>() * std::declval<drv_double>()), drv_double>);
+    static_assert(std::is_same_v<decltype(std::declval<sym_double>() * std::declval<drm_double>()), drm_double>);
+    static_assert(std::is_same_v<decltype(gram(std::declval<drm_double>())), sym_double>);
+
+    drm_double  dm(4, 3), dm2(3, 2);
+    drv_double  dv(3);
+
+    Fill(dm);
+    Fill(dm2);
+    Fill(dv);
+
+    sym_double  sm = gram(dm);
+    PRINT(sm);
+    cout << "sm == dm.t() * dm: " << (sm == dm.t() * dm) << endl;
+
+    sm(0, 2) = -1;
+    cout << "sm(2, 0): " << sm(2, 0) << endl;
+
+    drm_double  dsm;
+
+    dsm = sm;
+    PRINT(sm * dv);
+    cout << "sm * dv == dsm * dv: " << (sm * dv == dsm * dv) << endl;
+    PRINT(sm * dm2);
+    cout << "sm * dm2 == dsm * dm2: " << (sm * dm2 == dsm * dm2) << endl;
+
+    //- Products of bfloat16 operands are accumulated in float.  Each of the products below is
+    //  512, the sum of 512 terms, which would stall at 256 if it were accumulated in bfloat16.
+    //
+    using bfm = STD_LA::dyn_matrix<STD_LA::bfloat16>;
+    using bfv = STD_LA::dyn_vector<STD_LA::bfloat16>;
+
+    bfm     bm1(512, 2), bm2(1, 512), bm3(512, 2);
+    bfv     bx(512);
+
+    for (size_t i = 0;  i < 512;  ++i)
+    {
+        bm1(i, 0) = bm1(i, 1) = bm3(i, 0) = bm3(i, 1) = 1.0f;
+        bm2(0, i) = bx(i) = 1.0f;
+    }
+
+    auto    bs1 = gram(bm1);
+    auto    bs2 = gram(bm2);
+    bfv     bp1 = bs2 * bx;
+    bfm     bp2 = bs2 * bm3;
+
+    cout << "bf16 gram, sym*v, sym*m: " << float(bs1(1, 0)) << ", " << float(bp1(0)) << ", "
+         << float(bp2(0, 0)) << endl;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test exercises triangular views, their products, and the triangular solvers.
+//--------------------------------------------------------------------------------------------------
+//
+void t903()
+{
+    PRINT_FNAME();
+
+    using STD_LA::triangular_view;
+    using STD_LA::upper_triangle_tag;
+    using STD_LA::lower_triangle_tag;
+    using STD_LA::unit_diagonal_tag;
+
+    drm_double  dm(4, 4), dm2(4, 2);
+    drv_double  dv(4);
+
+    Fill(dm);
+    Fill(dm2);
+    Fill(dv);
+
+    auto    up = triangular_view<upper_triangle_tag>(dm);
+    auto    lu = triangular_view<lower_triangle_tag, unit_diagonal_tag>(dm);
+
+    static_assert(std::is_same_v<decltype(up * dv), drv_double>);
+    static_assert(std::is_same_v<decltype(lu * dm2), drm_double>);
+
+    PRINT(up);
+    PRINT(lu);
+
+    drm_double  dup, dlu;
+
+    dup = up;
+    dlu = lu;
+    cout << "up * dv == dup * dv: " << (up * dv == dup * dv) << endl;
+    cout << "lu * dv == dlu * dv: " << (lu * dv == dlu * dv) << endl;
+    cout << "up * dm2 == dup * dm2: " << (up * dm2 == dup * dm2) << endl;
+    cout << "lu * dm2 == dlu * dm2: " << (lu * dm2 == dlu * dm2) << endl;
+
+    auto    x1 = solve(up, dv);
+    PRINT(x1);
+    PRINT(up * x1);
+
+    auto    x2 = solve(lu, dm2);
+    PRINT(x2);
+    PRINT(lu * x2);
+
+    STD_LA::dyn_matrix<int>     im(2, 2);
+    STD_LA::dyn_vector<int>     iv(2);
+
+    im(0, 0) = 2;   im(0, 1) = 1;
+    im(1, 0) = 0;   im(1, 1) = 4;
+    iv(0) = 1;      iv(1) = 1;
+
+    auto    x3 = solve(triangular_view<upper_triangle_tag>(im), iv);
+    static_assert(std::is_same_v<decltype(x3), drv_double>);
+    PRINT(x3);
+    cout << "integer system solved in double: " << (x3(0) == 0.375 && x3(1) == 0.25) << endl;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test exercises diagonal matrices and their products.
+//--------------------------------------------------------------------------------------------------
+//
+void t904()
+{
+    PRINT_FNAME();
+
+    using diag_double_engine = STD_LA::diagonal_engine<double, std::allocator<double>>;
+
+    static_assert(std::is_same_v<decltype(std::declval<diag_double>() * std::declval<drv_double>()), drv_double>);
+    static_assert(std::is_same_v<decltype(std::declval<diag_double>() * std::declval<drm_double>()), drm_double>);
+    static_assert(std::is_same_v<decltype(std::declval<drm_double>() * std::declval<diag_double>()), drm_double>);
+    static_assert(std::is_same_v<decltype(std::declval<diag_double>() * std::declval<diag_double>()), diag_double>);
+
+    drm_double  dm(4, 4), dm2(4, 3), dm3(3, 4);
+    drv_double  dv(4);
+
+    Fill(dm);
+    Fill(dm2);
+    Fill(dm3);
+    Fill(dv);
+
+    diag_double     d1(diag_double_engine(4));
+    diag_double     d2;
+
+    for (size_t i = 0;  i < 4;  ++i)
+    {
+        d1.engine().diagonal_element(i) = static_cast<double>(i + 2);
+    }
+    d2 = dm;
+    PRINT(d1);
+    PRINT(d2);
+
+    drm_double  dd1;
+
+    dd1 = d1;
+    PRINT(d1 * dv);
+    cout << "d1 * dv == dd1 * dv: " << (d1 * dv == dd1 * dv) << endl;
+    PRINT(d1 * dm2);
+    cout << "d1 * dm2 == dd1 * dm2: " << (d1 * dm2 == dd1 * dm2) << endl;
+    PRINT(dm3 * d1);
+    cout << "dm3 * d1 == dm3 * dd1: " << (dm3 * d1 == dm3 * dd1) << endl;
+    PRINT(d1 * d2);
+    cout << "d1 * d2 == dd1 * d2: " << (d1 * d2 == dd1 * d2) << endl;
+
+    try
+    {
+        PRINT(dm2 * d1);
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+
+    try
+    {
+        PRINT(d1 * dm3);
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test exercises identity matrices and their products.
+//--------------------------------------------------------------------------------------------------
+//
+void t905()
+{
+    PRINT_FNAME();
+
+    using id_double_engine = STD_LA::identity_engine<double>;
+
+    static_assert(sizeof(id_double) == sizeof(size_t));
+    static_assert(std::is_same_v<decltype(std::declval<id_double>() * std::declval<drv_double>()), drv_double>);
+    static_assert(std::is_same_v<decltype(std::declval<id_double>() * std::declval<drm_double>()), drm_double>);
+    static_assert(std::is_same_v<decltype(std::declval<drm_double>() * std::declval<id_double>()), drm_double>);
+    static_assert(std::is_same_v<decltype(std::declval<id_double>() * std::declval<id_double>()), id_double>);
+
+    drm_double  dm(4, 3), dm2(3, 4);
+    drv_double  dv(4);
+
+    Fill(dm);
+    Fill(dm2);
+    Fill(dv);
+
+    id_double   id(id_double_engine(4));
+
+    PRINT(id);
+    PRINT(id * dv);
+    cout << "id * dv == dv: " << (id * dv == dv) << endl;
+    PRINT(id * dm);
+    cout << "id * dm == dm: " << (id * dm == dm) << endl;
+    cout << "dm2 * id == dm2: " << (dm2 * id == dm2) << endl;
+    cout << "(id * id).rows(): " << (id * id).rows() << endl;
+
+    try
+    {
+        PRINT(dm * id);
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test exercises low-rank (factored) matrices and their products.
+//--------------------------------------------------------------------------------------------------
+//
+void t906()
+{
+    PRINT_FNAME();
+
+    using STD_LA::low_rank;
+
+    static_assert(std::is_same_v<decltype(std::declval<lr_double>() * std::declval<drv_double>()), drv_double>);
+    static_assert(std::is_same_v<decltype(std::declval<lr_double>() * std::declval<drm_double>()), drm_double>);
+    static_assert(std::is_same_v<decltype(std::declval<drm_double>() * std::declval<lr_double>()), drm_double>);
+    static_assert(std::is_same_v<decltype(std::declval<lr_double>() * std::declval<lr_double>()), lr_double>);
+
+    drm_double  u1(5, 2), v1(4, 2), u2(4, 3), v2(3, 3), dm(4, 3), dm2(2, 5);
+    drv_double  dv(4);
+
+    Fill(u1);
+    Fill(v1);
+    Fill(u2);
+    Fill(v2);
+    Fill(dm);
+    Fill(dm2);
+    Fill(dv);
+
+    lr_double   lr1 = low_rank(u1, v1);
+    lr_double   lr2 = low_rank(u2, v2);
+    drm_double  dlr1, dlr2;
+
+    dlr1 = lr1;
+    dlr2 = lr2;
+    PRINT(lr1);
+    cout << "lr1 == u1 * v1.t(): " << (lr1 == u1 * v1.t()) << endl;
+
+    PRINT(lr1 * dv);
+    cout << "lr1 * dv == dlr1 * dv: " << (lr1 * dv == dlr1 * dv) << endl;
+    PRINT(lr1 * dm);
+    cout << "lr1 * dm == dlr1 * dm: " << (lr1 * dm == dlr1 * dm) << endl;
+    PRINT(dm2 * lr1);
+    cout << "dm2 * lr1 == dm2 * dlr1: " << (dm2 * lr1 == dm2 * dlr1) << endl;
+
+    auto    lr3 = lr1 * lr2;
+    PRINT(lr3);
+    cout << "lr3.rank(): " << lr3.engine().rank() << endl;
+    cout << "lr1 * lr2 == dlr1 * dlr2: " << (lr3 == dlr1 * dlr2) << endl;
+
+    //- Products of bfloat16 factors are accumulated in float.  Each of the products below is 512,
+    //  the sum of 512 terms, which would stall at 256 if it were accumulated in bfloat16.
+    //
+    using STD_LA::bfloat16;
+    using bfm = STD_LA::dyn_matrix<bfloat16>;
+    using bfv = STD_LA::dyn_vector<bfloat16>;
+
+    bfm     bu1(2, 1), bv1(512, 1), bu2(2, 512), bv2(3, 512), bm(512, 2), bm2(1, 2);
+    bfv     bx(512);
+
+    auto    set_all = [](auto& m, float value)
+    {
+        for (size_t i = 0;  i < (size_t) m.rows();  ++i)
+        {
+            for (size_t j = 0;  j < (size_t) m.columns();  ++j)
+            {
+                m(i, j) = value;
+            }
+        }
+    };
+
+    set_all(bu1, 1.0f);
+    set_all(bv1, 1.0f);
+    set_all(bu2, 1.0f);
+    set_all(bv2, 1.0f);
+    set_all(bm, 1.0f);
+    set_all(bm2, 0.5f);
+    for (size_t i = 0;  i < 512;  ++i) bx(i) = 1.0f;
+
+    auto    blr1 = low_rank(bu1, bv1);
+    auto    blr2 = low_rank(bu2, bv2);
+    auto    blr3 = low_rank(bv1, bv1);
+
+    bfv     bp1 = blr1 * bx;
+    bfm     bp2 = blr1 * bm;
+    bfm     bp3 = bm2 * blr2;
+    bfm     bp4 = blr1 * blr3;
+
+    cout << "bf16 lr*v, lr*m, m*lr, lr*lr: " << float(bp1(0)) << ", " << float(bp2(0, 0)) << ", "
+         << float(bp3(0, 0)) << ", " << float(bp4(0, 0)) << endl;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test exercises Toeplitz and circulant matrices, and their FFT-based products with vectors.
+//--------------------------------------------------------------------------------------------------
+//
+void t907()
+{
+    PRINT_FNAME();
+
+    static_assert(std::is_same_v<decltype(std::declval<toe_double>() * std::declval<drv_double>()), drv_double>);
+    static_assert(std::is_same_v<decltype(std::declval<circ_double>() * std::declval<drv_double>()), drv_double>);
+
+    auto    max_diff = [](drv_double const& a, drv_double const& b)
+    {
+        double  diff = 0;
+
+        for (size_t i = 0;  i < a.size();  ++i)
+        {
+            diff = std::max(diff, std::abs(a(i) - b(i)));
+        }
+        return diff;
+    };
+
+    //- Small products are computed directly.
+    //
+    drm_double  dm(4, 5), dc(5, 5);
+    drv_double  dv(5);
+
+    for (size_t i = 0;  i < 4;  ++i)
+    {
+        for (size_t j = 0;  j < 5;  ++j)
+        {
+            dm(i, j) = (j >= i) ? static_cast<double>(j - i + 1) : -static_cast<double>(2*(i - j));
+        }
+    }
+    for (size_t i = 0;  i < 5;  ++i)
+    {
+        for (size_t j = 0;  j < 5;  ++j)
+        {
+            dc(i, j) = static_cast<double>((i + 5 - j) % 5 + 1);
+        }
+    }
+    Fill(dv);
+
+    toe_double  tm;
+    circ_double cm;
+
+    tm = dm;
+    cm = dc;
+    PRINT(tm);
+    PRINT(cm);
+    cout << "tm == dm: " << (tm == dm) << endl;
+    cout << "cm == dc: " << (cm == dc) << endl;
+    PRINT(tm * dv);
+    cout << "tm * dv == dm * dv: " << (tm * dv == dm * dv) << endl;
+    PRINT(cm * dv);
+    cout << "cm * dv == dc * dv: " << (cm * dv == dc * dv) << endl;
+
+    //- Large products are computed by means of the FFT; the circulant size is not a power of two.
+    //
+    drm_double  dm2(150, 90), dc2(100, 100);
+    drv_double  dv2(90), dv3(100);
+    toe_double  tm2;
+    circ_double cm2;
+
+    for (size_t i = 0;  i < 150;  ++i)
+    {
+        for (size_t j = 0;  j < 90;  ++j)
+        {
+            dm2(i, j) = std::sin(0.37*(static_cast<double>(j) - static_cast<double>(i))) + ((j < i) ? 0.5 : 0.0);
+        }
+    }
+    for (size_t i = 0;  i < 100;  ++i)
+    {
+        for (size_t j = 0;  j < 100;  ++j)
+        {
+            dc2(i, j) = std::cos(0.1*static_cast<double>((i + 100 - j) % 100));
+        }
+    }
+    for (size_t i = 0;  i < 90;  ++i)   dv2(i) = std::sin(0.3*static_cast<double>(i));
+    for (size_t i = 0;  i < 100;  ++i)  dv3(i) = std::cos(0.7*static_cast<double>(i));
+
+    tm2 = dm2;
+    cm2 = dc2;
+    cout << "tm2 * dv2 ~= dm2 * dv2: " << (max_diff(tm2 * dv2, dm2 * dv2) < 1.0e-10) << endl;
+    cout << "cm2 * dv3 ~= dc2 * dv3: " << (max_diff(cm2 * dv3, dc2 * dv3) < 1.0e-10) << endl;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  This test exercises tiled matrices, in both tile orders, and their tile-wise kernels.
+//--------------------------------------------------------------------------------------------------
+//
+void t908()
+{
+    PRINT_FNAME();
+
+    static_assert(std::is_same_v<decltype(std::declval<tile_double>() * std::declval<ztile_double>()), tile_double>);
+    static_assert(std::is_same_v<decltype(std::declval<ztile_double>() + std::declval<tile_double>()), ztile_double>);
+
+    drm_double  dm(10, 7), dm2(7, 9), dm3(10, 7);
+
+    Fill(dm);
+    Fill(dm2);
+    for (size_t i = 0;  i < 10;  ++i)
+    {
+        for (size_t j = 0;  j < 7;  ++j)
+        {
+            dm3(i, j) = static_cast<double>(i) - static_cast<double>(j);
+        }
+    }
+
+    tile_double     tm, tm3;
+    ztile_double    zm2, zm3;
+
+    tm  = dm;
+    zm2 = dm2;
+    zm3 = dm3;
+    PRINT(tm);
+    PRINT(zm2);
+    cout << "tm == dm: " << (tm == dm) << endl;
+    cout << "zm2 == dm2: " << (zm2 == dm2) << endl;
+    cout << "tile grid: " << tm.engine().tile_rows() << "x" << tm.engine().tile_columns() << endl;
+
+    PRINT(tm * zm2);
+    cout << "tm * zm2 == dm * dm2: " << (tm * zm2 == dm * dm2) << endl;
+    PRINT(zm3 + tm);
+    cout << "zm3 + tm == dm3 + dm: " << (zm3 + tm == dm3 + dm) << endl;
+
+    tm3 = zm2.t();
+    PRINT(tm3);
+    cout << "tm3 == dm2.t(): " << (tm3 == dm2.t()) << endl;
+
+    try
+    {
+        tile_double     tm4, tm5;
+
+        tm4 = drm_double(8, 12);
+        tm5 = drm_double(8, 8);
+        PRINT(tm4 * tm5);
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+
+    try
+    {
+        PRINT(zm3 + zm2);
+    }
+    catch (std::exception const& ex)
+    {
+        cout << "exception: " << ex.what() << endl;
+    }
+}
+
+void
+TestGroup90()
+{
+    PRINT_FNAME();
+
+    t900();
+    t901();
+    t902();
+    t903();
+    t904();
+    t905();
+    t906();
+    t907();
+    t908();
+}